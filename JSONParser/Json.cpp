@@ -1,7 +1,22 @@
 #include "Json.h"
 #include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <set>
 #include <stdexcept>
-#include <iomanip>
+#include <thread>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 // ========== Getters ==========
 
@@ -14,30 +29,101 @@ bool Json::as_bool() const
 
 double Json::as_number() const
 {
-	if (!is_number())
+	if (std::holds_alternative<int64_t>(value))
+		return static_cast<double>(std::get<int64_t>(value));
+	if (std::holds_alternative<uint64_t>(value))
+		return static_cast<double>(std::get<uint64_t>(value));
+	if (!std::holds_alternative<double>(value))
 		throw std::runtime_error("JSON value is not a number");
 	return std::get<double>(value);
 }
 
+int64_t Json::as_int() const
+{
+	if (std::holds_alternative<int64_t>(value))
+		return std::get<int64_t>(value);
+	if (std::holds_alternative<uint64_t>(value)) {
+		uint64_t u = std::get<uint64_t>(value);
+		if (u > static_cast<uint64_t>(INT64_MAX))
+			throw std::runtime_error("JSON value does not fit in int64_t");
+		return static_cast<int64_t>(u);
+	}
+	throw std::runtime_error("JSON value is not an integer");
+}
+
+uint64_t Json::as_uint() const
+{
+	if (std::holds_alternative<uint64_t>(value))
+		return std::get<uint64_t>(value);
+	if (std::holds_alternative<int64_t>(value)) {
+		int64_t i = std::get<int64_t>(value);
+		if (i < 0)
+			throw std::runtime_error("JSON value does not fit in uint64_t");
+		return static_cast<uint64_t>(i);
+	}
+	throw std::runtime_error("JSON value is not an integer");
+}
+
 const std::string& Json::as_string() const
 {
+	if (is_string_view())
+		throw std::runtime_error("JSON value is a string view; use as_string_view()");
 	if (!is_string())
 		throw std::runtime_error("JSON value is not a string");
 	return std::get<std::string>(value);
 }
 
+std::string_view Json::as_string_view() const
+{
+	if (std::holds_alternative<std::string_view>(value))
+		return std::get<std::string_view>(value);
+	if (std::holds_alternative<std::string>(value))
+		return std::get<std::string>(value);
+	throw std::runtime_error("JSON value is not a string");
+}
+
 const JsonArray& Json::as_array() const
 {
+	if (is_raw())
+		throw std::runtime_error("JSON value is an unparsed lazy subtree; call materialize()");
 	if (!is_array())
 		throw std::runtime_error("JSON value is not an array");
 	return std::get<JsonArray>(value);
 }
 
+const JsonRaw& Json::as_raw() const
+{
+	if (!is_raw())
+		throw std::runtime_error("JSON value is not an unparsed subtree");
+	return *std::get<JsonBox<JsonRaw>>(value);
+}
+
+void Json::materialize()
+{
+	if (!is_raw())
+		return;
+	JsonRaw raw = *std::get<JsonBox<JsonRaw>>(value);
+	// options.lazy stays set, so only one more level parses eagerly and
+	// deeper subtrees remain raw until they are touched
+	*this = Json::parse(raw.text, raw.options);
+}
+
 const JsonObject& Json::as_object() const
 {
+	if (is_raw())
+		throw std::runtime_error("JSON value is an unparsed lazy subtree; call materialize()");
+	if (is_flat_object())
+		throw std::runtime_error("JSON value is a flat object; use as_flat_object()");
 	if (!is_object())
 		throw std::runtime_error("JSON value is not an object");
-	return std::get<JsonObject>(value);
+	return *std::get<JsonBox<JsonObject>>(value);
+}
+
+const JsonFlatObject& Json::as_flat_object() const
+{
+	if (!is_flat_object())
+		throw std::runtime_error("JSON value is not a flat object");
+	return std::get<JsonFlatObject>(value);
 }
 
 JsonArray& Json::as_array()
@@ -49,15 +135,26 @@ JsonArray& Json::as_array()
 
 JsonObject& Json::as_object()
 {
+	if (is_flat_object())
+		throw std::runtime_error("JSON value is a flat object; use as_flat_object()");
 	if (!is_object())
 		throw std::runtime_error("JSON value is not an object");
-	return std::get<JsonObject>(value);
+	return *std::get<JsonBox<JsonObject>>(value);
+}
+
+JsonFlatObject& Json::as_flat_object()
+{
+	if (!is_flat_object())
+		throw std::runtime_error("JSON value is not a flat object");
+	return std::get<JsonFlatObject>(value);
 }
 
 // ========== Array/Object Access Operators ==========
 
 Json& Json::operator[](size_t index)
 {
+	if (is_raw())
+		materialize();
 	return as_array()[index];
 }
 
@@ -68,11 +165,32 @@ const Json& Json::operator[](size_t index) const
 
 Json& Json::operator[](const std::string& key)
 {
+	if (is_raw())
+		materialize();
+	if (is_flat_object()) {
+		auto& obj = as_flat_object();
+		for (auto& [entry_key, entry_value] : obj) {
+			if (entry_key == key)
+				return entry_value;
+		}
+		obj.emplace_back(key, Json());
+		return obj.back().second;
+	}
 	return as_object()[key];
 }
 
 const Json& Json::operator[](const std::string& key) const
 {
+	if (is_raw())
+		throw std::runtime_error("JSON value is an unparsed lazy subtree; call materialize()");
+	if (is_flat_object()) {
+		const auto& obj = as_flat_object();
+		for (const auto& [entry_key, entry_value] : obj) {
+			if (entry_key == key)
+				return entry_value;
+		}
+		throw std::runtime_error("Key not found: " + key);
+	}
 	auto& obj = as_object();
 	auto it = obj.find(key);
 	if (it == obj.end())
@@ -80,102 +198,762 @@ const Json& Json::operator[](const std::string& key) const
 	return it->second;
 }
 
+// ========== Key Interning ==========
+
+const std::string& JsonKeyPool::intern(std::string_view key)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto it = index_.find(key);
+	if (it != index_.end())
+		return *it->second;
+
+	// std::deque never moves settled elements, so the reference is stable
+	storage_.emplace_back(key);
+	const std::string& stored = storage_.back();
+	index_.emplace(std::string_view(stored), &stored);
+	return stored;
+}
+
+size_t JsonKeyPool::size() const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return storage_.size();
+}
+
+// ========== JSON Pointer ==========
+
+// Splits the next reference token off an RFC 6901 pointer (which must start
+// with '/'), decoding the ~1 and ~0 escapes.
+static std::string take_pointer_token(std::string_view& pointer)
+{
+	pointer.remove_prefix(1);
+	size_t slash = pointer.find('/');
+	std::string_view raw = pointer.substr(0, slash);
+	pointer = slash == std::string_view::npos ? std::string_view() : pointer.substr(slash);
+
+	std::string token;
+	token.reserve(raw.size());
+	for (size_t i = 0; i < raw.size(); ++i) {
+		if (raw[i] != '~') {
+			token += raw[i];
+			continue;
+		}
+		if (i + 1 < raw.size() && raw[i + 1] == '0')
+			token += '~';
+		else if (i + 1 < raw.size() && raw[i + 1] == '1')
+			token += '/';
+		else
+			throw std::runtime_error("Invalid JSON pointer escape");
+		++i;
+	}
+	return token;
+}
+
+// Array reference tokens are digits without a leading zero (except "0").
+// The length cap rejects tokens that would overflow the index arithmetic.
+static bool pointer_token_to_index(const std::string& token, size_t& index)
+{
+	if (token.empty() || token.size() > 19 || (token.size() > 1 && token[0] == '0'))
+		return false;
+	index = 0;
+	for (char c : token) {
+		if (c < '0' || c > '9')
+			return false;
+		index = index * 10 + static_cast<size_t>(c - '0');
+	}
+	return true;
+}
+
+const Json& Json::at_pointer(std::string_view pointer) const
+{
+	const Json* current = this;
+	while (!pointer.empty()) {
+		if (pointer[0] != '/')
+			throw std::runtime_error("Invalid JSON pointer: must start with '/'");
+		std::string token = take_pointer_token(pointer);
+
+		if (current->is_array()) {
+			size_t index = 0;
+			if (!pointer_token_to_index(token, index))
+				throw std::runtime_error("Invalid array index in JSON pointer: " + token);
+			const auto& arr = current->as_array();
+			if (index >= arr.size())
+				throw std::runtime_error("Array index out of range in JSON pointer: " + token);
+			current = &arr[index];
+		}
+		else if (current->is_object()) {
+			current = &(*current)[token];
+		}
+		else {
+			throw std::runtime_error("JSON pointer descends into a non-container value");
+		}
+	}
+	return *current;
+}
+
 // ========== Serialization ==========
 
 std::string Json::stringify(bool pretty, int indent) const
 {
-	std::ostringstream oss;
-	auto make_indent = [&]() {
-		if (pretty) {
-			for (int i = 0; i < indent * 2; ++i)
-				oss << ' ';
+	std::string out;
+	stringify_to(out, pretty, indent);
+	return out;
+}
+
+// Escapes s and appends it, quoted, to out
+static void append_escaped_string(std::string& out, std::string_view s)
+{
+	out += '"';
+	for (char c : s) {
+		switch (c) {
+		case '"': out += "\\\""; break;
+		case '\\': out += "\\\\"; break;
+		case '\b': out += "\\b"; break;
+		case '\f': out += "\\f"; break;
+		case '\n': out += "\\n"; break;
+		case '\r': out += "\\r"; break;
+		case '\t': out += "\\t"; break;
+		default:
+			if (static_cast<unsigned char>(c) < 0x20) {
+				char buf[8];
+				std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+				out += buf;
+			}
+			else {
+				out += c;
+			}
 		}
-	};
+	}
+	out += '"';
+}
 
-	if (is_null()) {
-		oss << "null";
+static void append_number(std::string& out, double num)
+{
+	// Shortest representation that round-trips to the same double, computed
+	// without touching the locale. Integral values come out without a
+	// trailing ".0" (42.0 -> "42"), so no separate integer branch is needed.
+	char buf[32];
+	auto result = std::to_chars(buf, buf + sizeof(buf), num);
+	out.append(buf, result.ptr);
+}
+
+// Appends one non-container value in its final textual form
+static void append_scalar_value(std::string& out, const Json& v)
+{
+	if (v.is_null()) {
+		out += "null";
 	}
-	else if (is_bool()) {
-		oss << (as_bool() ? "true" : "false");
+	else if (v.is_bool()) {
+		out += v.as_bool() ? "true" : "false";
 	}
-	else if (is_number()) {
-		double num = as_number();
-		// Check if the number is an integer
-		if (num == static_cast<long long>(num)) {
-			oss << static_cast<long long>(num);
+	else if (v.is_uint()) {
+		char buf[24];
+		auto result = std::to_chars(buf, buf + sizeof(buf), v.as_uint());
+		out.append(buf, result.ptr);
+	}
+	else if (v.is_int()) {
+		char buf[24];
+		auto result = std::to_chars(buf, buf + sizeof(buf), v.as_int());
+		out.append(buf, result.ptr);
+	}
+	else if (v.is_number()) {
+		append_number(out, v.as_number());
+	}
+	else {
+		append_escaped_string(out, v.as_string_view());
+	}
+}
+
+static bool is_empty_container(const Json& v)
+{
+	if (v.is_array()) return v.as_array().empty();
+	if (v.is_flat_object()) return v.as_flat_object().empty();
+	return v.as_object().empty();
+}
+
+void Json::stringify_to(std::string& out, bool pretty, int indent) const
+{
+	JsonFormat format;
+	format.pretty = pretty;
+	JsonStringSink sink(out);
+	JsonWriter writer(sink);
+	writer.write(*this, format, indent);
+}
+
+std::string Json::stringify(const JsonFormat& format) const
+{
+	std::string out;
+	stringify_to(out, format);
+	return out;
+}
+
+void Json::stringify_to(std::string& out, const JsonFormat& format) const
+{
+	JsonStringSink sink(out);
+	JsonWriter writer(sink);
+	writer.write(*this, format);
+}
+
+// Appends one line's indentation for depth from the cached indent table -
+// one bulk append instead of a character loop per line
+void JsonWriter::append_indent(const JsonFormat& format, int depth)
+{
+	if (!indent_cache_.empty() && indent_cache_[0] != format.indent_char)
+		indent_cache_.clear();  // The writer was reused with another style
+	size_t needed = static_cast<size_t>(depth) * static_cast<size_t>(format.indent_width);
+	if (indent_cache_.size() < needed)
+		indent_cache_.append(needed - indent_cache_.size(), format.indent_char);
+	buffer_.append(indent_cache_.data(), needed);
+}
+
+// Emits a scalar inline, or an opener plus a new frame for a container
+void JsonWriter::write_child(const Json& child, const JsonFormat& format, int indent)
+{
+	if (child.is_raw()) {
+		// Verbatim: the span is the exact (already valid) text of the value
+		std::string_view raw = child.as_raw().text;
+		buffer_.append(raw.data(), raw.size());
+		return;
+	}
+	if (child.is_array() || child.is_object()) {
+		if (is_empty_container(child)) {
+			buffer_ += child.is_array() ? "[]" : "{}";
+			return;
 		}
-		else {
-			oss << num;
+		buffer_ += child.is_array() ? '[' : '{';
+		Frame frame{ &child, 0, JsonObject::const_iterator(), indent, {} };
+		if (!child.is_array() && !child.is_flat_object()) {
+			frame.map_it = child.as_object().begin();
+		}
+		else if (child.is_flat_object() && format.sort_keys) {
+			// Canonical order for the insertion-ordered representation
+			const auto& obj = child.as_flat_object();
+			frame.order.resize(obj.size());
+			for (uint32_t i = 0; i < obj.size(); ++i)
+				frame.order[i] = i;
+			std::sort(frame.order.begin(), frame.order.end(),
+				[&obj](uint32_t a, uint32_t b) { return obj[a].first < obj[b].first; });
 		}
+		stack_.push_back(std::move(frame));
+		return;
 	}
-	else if (is_string()) {
-		oss << '"';
-		for (char c : as_string()) {
-			switch (c) {
-			case '"': oss << "\\\""; break;
-			case '\\': oss << "\\\\"; break;
-			case '\b': oss << "\\b"; break;
-			case '\f': oss << "\\f"; break;
-			case '\n': oss << "\\n"; break;
-			case '\r': oss << "\\r"; break;
-			case '\t': oss << "\\t"; break;
-			default:
-				if (static_cast<unsigned char>(c) < 0x20) {
-					oss << "\\u" << std::hex << std::setw(4) << std::setfill('0')
-						<< static_cast<int>(c);
-				}
-				else {
-					oss << c;
-				}
+	append_scalar_value(buffer_, child);
+}
+
+void JsonWriter::write(const Json& value, const JsonFormat& format, int base_depth)
+{
+	write_child(value, format, base_depth);
+	if (format.pretty && !stack_.empty())
+		buffer_ += '\n';
+
+	while (!stack_.empty()) {
+		Frame& frame = stack_.back();
+		const Json& node = *frame.node;
+		bool node_is_array = node.is_array();
+		size_t count = node_is_array ? node.as_array().size()
+			: node.is_flat_object() ? node.as_flat_object().size() : node.as_object().size();
+
+		if (frame.index == count) {
+			// Close this container, then finish the parent's element slot
+			if (format.pretty)
+				append_indent(format, frame.indent);
+			buffer_ += node_is_array ? ']' : '}';
+			stack_.pop_back();
+			if (!stack_.empty()) {
+				Frame& parent = stack_.back();
+				const Json& parent_node = *parent.node;
+				size_t parent_count = parent_node.is_array() ? parent_node.as_array().size()
+					: parent_node.is_flat_object() ? parent_node.as_flat_object().size()
+					: parent_node.as_object().size();
+				if (parent.index < parent_count)
+					buffer_ += ',';
+				if (format.pretty)
+					buffer_ += '\n';
 			}
+			maybe_flush();
+			continue;
+		}
+
+		if (format.pretty)
+			append_indent(format, frame.indent + 1);
+
+		const Json* child = nullptr;
+		if (node_is_array) {
+			child = &node.as_array()[frame.index];
+		}
+		else if (node.is_flat_object()) {
+			size_t member = frame.order.empty() ? frame.index : frame.order[frame.index];
+			const auto& entry = node.as_flat_object()[member];
+			append_escaped_string(buffer_, entry.first);
+			buffer_ += ": ";
+			child = &entry.second;
+		}
+		else {
+			append_escaped_string(buffer_, frame.map_it->first);
+			buffer_ += ": ";
+			child = &frame.map_it->second;
+			++frame.map_it;
 		}
-		oss << '"';
+		++frame.index;
+
+		size_t depth_before = stack_.size();
+		write_child(*child, format, frame.indent + 1);
+		if (stack_.size() == depth_before) {
+			// Scalar or empty container: finish the element slot here. Note
+			// that frame may be invalid after a push, hence the re-read.
+			Frame& current = stack_.back();
+			size_t current_count = node_is_array ? node.as_array().size()
+				: node.is_flat_object() ? node.as_flat_object().size() : node.as_object().size();
+			if (current.index < current_count)
+				buffer_ += ',';
+			if (format.pretty)
+				buffer_ += '\n';
+		}
+		else if (format.pretty) {
+			buffer_ += '\n';
+		}
+		maybe_flush();
+	}
+
+	flush();
+}
+
+// ========== Binary Encoding ==========
+
+// One tag byte per value; containers carry a varint count, strings a varint
+// byte length, fixed-width numbers are memcpy'd native-endian.
+namespace binary_tags {
+enum : unsigned char
+{
+	kNull = 0,
+	kFalse = 1,
+	kTrue = 2,
+	kInt = 3,
+	kUint = 4,
+	kDouble = 5,
+	kString = 6,
+	kArray = 7,
+	kObject = 8,
+	kFlatObject = 9,
+};
+}
+
+static void append_varint(std::string& out, uint64_t v)
+{
+	while (v >= 0x80) {
+		out += static_cast<char>(static_cast<unsigned char>(v) | 0x80);
+		v >>= 7;
+	}
+	out += static_cast<char>(v);
+}
+
+static uint64_t read_varint(std::string_view data, size_t& pos)
+{
+	uint64_t result = 0;
+	int shift = 0;
+	while (true) {
+		if (pos >= data.size())
+			throw JsonParseError("Truncated binary document", pos);
+		unsigned char byte = static_cast<unsigned char>(data[pos++]);
+		result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+		if (!(byte & 0x80))
+			return result;
+		shift += 7;
+		if (shift >= 64)
+			throw JsonParseError("Invalid varint in binary document", pos);
+	}
+}
+
+template <typename T>
+static void append_fixed(std::string& out, T v)
+{
+	char buf[sizeof(T)];
+	std::memcpy(buf, &v, sizeof(T));
+	out.append(buf, sizeof(T));
+}
+
+template <typename T>
+static T read_fixed(std::string_view data, size_t& pos)
+{
+	if (data.size() - pos < sizeof(T) || pos > data.size())
+		throw JsonParseError("Truncated binary document", pos);
+	T v;
+	std::memcpy(&v, data.data() + pos, sizeof(T));
+	pos += sizeof(T);
+	return v;
+}
+
+void Json::to_binary(std::string& out) const
+{
+	using namespace binary_tags;
+
+	if (is_raw())
+		throw std::runtime_error("JSON value is an unparsed lazy subtree; call materialize()");
+	if (is_null()) {
+		out += static_cast<char>(kNull);
+	}
+	else if (is_bool()) {
+		out += static_cast<char>(as_bool() ? kTrue : kFalse);
+	}
+	else if (is_uint()) {
+		out += static_cast<char>(kUint);
+		append_fixed(out, as_uint());
+	}
+	else if (is_int()) {
+		out += static_cast<char>(kInt);
+		append_fixed(out, as_int());
+	}
+	else if (is_number()) {
+		out += static_cast<char>(kDouble);
+		append_fixed(out, as_number());
+	}
+	else if (is_string()) {
+		std::string_view s = as_string_view();
+		out += static_cast<char>(kString);
+		append_varint(out, s.size());
+		out.append(s.data(), s.size());
 	}
 	else if (is_array()) {
 		const auto& arr = as_array();
-		oss << '[';
-		if (pretty && !arr.empty()) oss << '\n';
-
-		for (size_t i = 0; i < arr.size(); ++i) {
-			if (pretty) make_indent();
-			if (pretty) oss << "  ";
-			oss << arr[i].stringify(pretty, indent + 1);
-			if (i < arr.size() - 1) oss << ',';
-			if (pretty) oss << '\n';
+		out += static_cast<char>(kArray);
+		append_varint(out, arr.size());
+		for (const auto& element : arr)
+			element.to_binary(out);
+	}
+	else if (is_flat_object()) {
+		const auto& obj = as_flat_object();
+		out += static_cast<char>(kFlatObject);
+		append_varint(out, obj.size());
+		for (const auto& [key, val] : obj) {
+			append_varint(out, key.size());
+			out.append(key.data(), key.size());
+			val.to_binary(out);
 		}
-
-		if (pretty && !arr.empty()) make_indent();
-		oss << ']';
 	}
-	else if (is_object()) {
+	else {
 		const auto& obj = as_object();
-		oss << '{';
-		if (pretty && !obj.empty()) oss << '\n';
-
-		size_t i = 0;
+		out += static_cast<char>(kObject);
+		append_varint(out, obj.size());
 		for (const auto& [key, val] : obj) {
-			if (pretty) make_indent();
-			if (pretty) oss << "  ";
-			oss << '"' << key << "\": ";
-			oss << val.stringify(pretty, indent + 1);
-			if (i < obj.size() - 1) oss << ',';
-			if (pretty) oss << '\n';
-			++i;
+			append_varint(out, key.size());
+			out.append(key.data(), key.size());
+			val.to_binary(out);
+		}
+	}
+}
+
+static std::string_view read_binary_bytes(std::string_view data, size_t& pos, size_t count)
+{
+	if (data.size() - pos < count || pos > data.size())
+		throw JsonParseError("Truncated binary document", pos);
+	std::string_view bytes = data.substr(pos, count);
+	pos += count;
+	return bytes;
+}
+
+static Json decode_binary_value(std::string_view data, size_t& pos,
+	const JsonParseOptions& options, size_t depth)
+{
+	using namespace binary_tags;
+
+	if (depth > options.max_depth)
+		throw JsonParseError("Maximum nesting depth exceeded", pos);
+	if (pos >= data.size())
+		throw JsonParseError("Truncated binary document", pos);
+
+	unsigned char tag = static_cast<unsigned char>(data[pos++]);
+	switch (tag) {
+	case kNull: return Json(nullptr);
+	case kFalse: return Json(false);
+	case kTrue: return Json(true);
+	case kInt: return Json(read_fixed<int64_t>(data, pos));
+	case kUint: return Json(read_fixed<uint64_t>(data, pos));
+	case kDouble: return Json(read_fixed<double>(data, pos));
+
+	case kString: {
+		size_t size = static_cast<size_t>(read_varint(data, pos));
+		std::string_view bytes = read_binary_bytes(data, pos, size);
+		if (options.string_views)
+			return Json(bytes);
+		return Json(std::string(bytes));
+	}
+
+	case kArray: {
+		size_t count = static_cast<size_t>(read_varint(data, pos));
+		// Every element costs at least one byte, so a count beyond the
+		// remaining input is corrupt - reject before reserving
+		if (count > data.size() - pos)
+			throw JsonParseError("Truncated binary document", pos);
+		JsonArray arr;
+		arr.reserve(count);
+		for (size_t i = 0; i < count; ++i)
+			arr.push_back(decode_binary_value(data, pos, options, depth + 1));
+		return Json(std::move(arr));
+	}
+
+	case kObject: {
+		size_t count = static_cast<size_t>(read_varint(data, pos));
+		if (count > data.size() - pos)
+			throw JsonParseError("Truncated binary document", pos);
+		JsonObject obj;
+		for (size_t i = 0; i < count; ++i) {
+			size_t key_size = static_cast<size_t>(read_varint(data, pos));
+			std::string_view key = read_binary_bytes(data, pos, key_size);
+			obj.insert_or_assign(std::string(key), decode_binary_value(data, pos, options, depth + 1));
 		}
+		return Json(std::move(obj));
+	}
+
+	case kFlatObject: {
+		size_t count = static_cast<size_t>(read_varint(data, pos));
+		if (count > data.size() - pos)
+			throw JsonParseError("Truncated binary document", pos);
+		JsonFlatObject obj;
+		obj.reserve(count);
+		for (size_t i = 0; i < count; ++i) {
+			size_t key_size = static_cast<size_t>(read_varint(data, pos));
+			std::string_view key = read_binary_bytes(data, pos, key_size);
+			obj.emplace_back(std::string(key), decode_binary_value(data, pos, options, depth + 1));
+		}
+		return Json(std::move(obj));
+	}
+
+	default:
+		throw JsonParseError("Unknown tag in binary document", pos - 1);
+	}
+}
+
+Json Json::from_binary(std::string_view data, const JsonParseOptions& options)
+{
+	size_t pos = 0;
+	Json result = decode_binary_value(data, pos, options, 1);
+	if (pos != data.size())
+		throw JsonParseError("Unexpected bytes after binary document", pos);
+	return result;
+}
+
+// ========== Scanning Kernels ==========
+
+// SSE2 is the baseline on every x64 target (and opt-in on x86), so the
+// vector path is selected at compile time with a scalar fallback for other
+// architectures. 16 bytes per iteration instead of one.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define JSONPARSER_SSE2 1
+#include <emmintrin.h>
+#include <bit>
+#endif
+
+// Returns the index of the first byte at or after pos that is not JSON
+// whitespace (space, tab, newline, carriage return), or text.size().
+static size_t scan_past_whitespace(std::string_view text, size_t pos)
+{
+#ifdef JSONPARSER_SSE2
+	const __m128i space = _mm_set1_epi8(' ');
+	const __m128i tab = _mm_set1_epi8('\t');
+	const __m128i newline = _mm_set1_epi8('\n');
+	const __m128i carriage = _mm_set1_epi8('\r');
+
+	while (pos + 16 <= text.size()) {
+		__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + pos));
+		__m128i is_ws = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab)),
+			_mm_or_si128(_mm_cmpeq_epi8(chunk, newline), _mm_cmpeq_epi8(chunk, carriage)));
+		unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(is_ws));
+		if (mask != 0xFFFF)
+			return pos + std::countr_one(mask);
+		pos += 16;
+	}
+#endif
+	while (pos < text.size()) {
+		char c = text[pos];
+		if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+			break;
+		++pos;
+	}
+	return pos;
+}
+
+// Returns the index of the first '"' or '\\' at or after pos, or text.size().
+// This is the inner loop of string parsing: everything before the returned
+// index is a plain span that needs no per-byte inspection.
+static size_t scan_to_string_special(std::string_view text, size_t pos)
+{
+#ifdef JSONPARSER_SSE2
+	const __m128i quote = _mm_set1_epi8('"');
+	const __m128i backslash = _mm_set1_epi8('\\');
+
+	while (pos + 16 <= text.size()) {
+		__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + pos));
+		__m128i is_special = _mm_or_si128(
+			_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash));
+		unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(is_special));
+		if (mask != 0)
+			return pos + std::countr_zero(mask);
+		pos += 16;
+	}
+#endif
+	while (pos < text.size() && text[pos] != '"' && text[pos] != '\\')
+		++pos;
+	return pos;
+}
+
+// ========== UTF-8 Helpers ==========
+
+// Reads four hex digits at text[pos..pos+4); false on a non-hex digit
+static bool read_hex4(std::string_view text, size_t pos, uint32_t& out)
+{
+	if (pos + 4 > text.size())
+		return false;
+	out = 0;
+	for (size_t i = pos; i < pos + 4; ++i) {
+		char c = text[i];
+		uint32_t digit;
+		if (c >= '0' && c <= '9') digit = static_cast<uint32_t>(c - '0');
+		else if (c >= 'a' && c <= 'f') digit = static_cast<uint32_t>(c - 'a' + 10);
+		else if (c >= 'A' && c <= 'F') digit = static_cast<uint32_t>(c - 'A' + 10);
+		else return false;
+		out = (out << 4) | digit;
+	}
+	return true;
+}
+
+// Appends a code point as UTF-8 (code is already validated <= 0x10FFFF)
+static void append_utf8(std::string& out, uint32_t code)
+{
+	if (code < 0x80) {
+		out += static_cast<char>(code);
+	}
+	else if (code < 0x800) {
+		out += static_cast<char>(0xC0 | (code >> 6));
+		out += static_cast<char>(0x80 | (code & 0x3F));
+	}
+	else if (code < 0x10000) {
+		out += static_cast<char>(0xE0 | (code >> 12));
+		out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+		out += static_cast<char>(0x80 | (code & 0x3F));
+	}
+	else {
+		out += static_cast<char>(0xF0 | (code >> 18));
+		out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+		out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+		out += static_cast<char>(0x80 | (code & 0x3F));
+	}
+}
 
-		if (pretty && !obj.empty()) make_indent();
-		oss << '}';
+// Below this size a linear scan over the contiguous pairs beats hashing;
+// above it the scan would make object building quadratic, so the frame
+// gets a key -> slot index.
+static constexpr size_t kFlatIndexThreshold = 32;
+
+// Finds key's slot in a flat object, building and maintaining the
+// frame's hash index once the object crosses the threshold. Returns
+// JsonIndex::npos when the key is absent.
+static size_t flat_find(const JsonFlatObject& obj,
+	std::unique_ptr<std::unordered_map<std::string, uint32_t>>& index,
+	const std::string& key)
+{
+	if (!index) {
+		if (obj.size() < kFlatIndexThreshold) {
+			for (size_t i = 0; i < obj.size(); ++i) {
+				if (obj[i].first == key)
+					return i;
+			}
+			return JsonIndex::npos;
+		}
+		index = std::make_unique<std::unordered_map<std::string, uint32_t>>();
+		index->reserve(obj.size() * 2);
+		for (size_t i = 0; i < obj.size(); ++i)
+			index->emplace(obj[i].first, static_cast<uint32_t>(i));
 	}
+	auto it = index->find(key);
+	return it == index->end() ? JsonIndex::npos : it->second;
+}
+
+// Registers a freshly appended entry with the frame's index, if one
+// has been built
+static void flat_register(std::unique_ptr<std::unordered_map<std::string, uint32_t>>& index,
+	const std::string& key, size_t slot)
+{
+	if (index)
+		index->emplace(key, static_cast<uint32_t>(slot));
+}
 
-	return oss.str();
+// Decodes an already validated raw string span (the text between the
+// quotes) into UTF-8; used where a decoded key is needed outside the parser.
+static std::string decode_string_span(std::string_view span)
+{
+	std::string out;
+	out.reserve(span.size());
+	size_t pos = 0;
+	while (pos < span.size()) {
+		size_t special = scan_to_string_special(span, pos);
+		out.append(span.data() + pos, special - pos);
+		pos = special;
+		if (pos >= span.size())
+			break;
+		// Backslash: the span is validated, so the escape is well-formed
+		char escaped = span[pos + 1];
+		switch (escaped) {
+		case '"': out += '"'; pos += 2; break;
+		case '\\': out += '\\'; pos += 2; break;
+		case '/': out += '/'; pos += 2; break;
+		case 'b': out += '\b'; pos += 2; break;
+		case 'f': out += '\f'; pos += 2; break;
+		case 'n': out += '\n'; pos += 2; break;
+		case 'r': out += '\r'; pos += 2; break;
+		case 't': out += '\t'; pos += 2; break;
+		default: {  // 'u'
+			uint32_t code = 0;
+			read_hex4(span, pos + 2, code);
+			pos += 6;
+			if (code >= 0xD800 && code <= 0xDBFF) {
+				uint32_t low = 0;
+				read_hex4(span, pos + 2, low);
+				pos += 6;
+				code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+			}
+			append_utf8(out, code);
+			break;
+		}
+		}
+	}
+	return out;
 }
 
 // ========== Parser Implementation ==========
 
+// Statistics collection is compiled out entirely unless the build defines
+// JSONPARSER_ENABLE_STATS: JSONPARSER_STAT guards every counter update and
+// JSONPARSER_STAT_TIMER accumulates a phase's wall time on scope exit.
+#ifdef JSONPARSER_ENABLE_STATS
+#define JSONPARSER_STAT(expr) do { if (stats_) { expr; } } while (0)
+struct JsonStatTimer
+{
+	double* sink;
+	std::chrono::steady_clock::time_point start;
+	explicit JsonStatTimer(double* s)
+		: sink(s), start(s ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point()) {}
+	~JsonStatTimer()
+	{
+		if (sink)
+			*sink += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+};
+#define JSONPARSER_STAT_TIMER(field) JsonStatTimer stat_timer_(stats_ ? &stats_->field : nullptr)
+#else
+#define JSONPARSER_STAT(expr) do {} while (0)
+#define JSONPARSER_STAT_TIMER(field) do {} while (0)
+#endif
+
 class JsonParser
 {
 public:
-	JsonParser(const std::string& json) : json_(json), pos_(0) {}
+	// Options select string-view and flat-object parsing; with an arena, all
+	// container storage for the tree is bump-allocated from it. stats, when
+	// given (and compiled in), receives token counts and phase timings.
+	explicit JsonParser(std::string_view json, const JsonParseOptions& options = {},
+		JsonArena* arena = nullptr, JsonParseStats* stats = nullptr)
+		: json_(json), pos_(0), options_(options), arena_(arena), stats_(stats) {}
 
 	Json parse()
 	{
@@ -188,9 +966,73 @@ public:
 		return result;
 	}
 
+	// Schema-guided variant of parse()
+	Json parse(const JsonSchema& schema)
+	{
+		Json result = parse_schema_value(schema);
+		skip_whitespace();
+		if (pos_ < json_.size()) {
+			throw JsonParseError("Unexpected characters after JSON value", pos_);
+		}
+		return result;
+	}
+
+	// SAX entry point: same grammar as parse(), but fires handler events
+	// instead of building a tree. Returns false if the handler aborted.
+	bool parse(JsonSaxHandler& handler)
+	{
+		skip_whitespace();
+		if (!sax_value(handler))
+			return false;
+		skip_whitespace();
+		if (pos_ < json_.size()) {
+			throw JsonParseError("Unexpected characters after JSON value", pos_);
+		}
+		return true;
+	}
+
+	// Navigates a JSON Pointer over the raw text, skipping everything off
+	// the pointer's path, and materializes only the target value. Stops
+	// reading input the moment the target is extracted.
+	bool extract_pointer(std::string_view pointer, Json& out)
+	{
+		while (!pointer.empty()) {
+			if (pointer[0] != '/')
+				throw std::runtime_error("Invalid JSON pointer: must start with '/'");
+			std::string token = take_pointer_token(pointer);
+
+			skip_whitespace();
+			char c = current();
+			if (c == '{') {
+				if (!descend_into_object_member(token))
+					return false;
+			}
+			else if (c == '[') {
+				size_t index = 0;
+				if (!pointer_token_to_index(token, index))
+					return false;
+				if (!descend_into_array_element(index))
+					return false;
+			}
+			else {
+				// Pointer descends into a scalar
+				return false;
+			}
+		}
+
+		skip_whitespace();
+		out = parse_value();
+		return true;
+	}
+
 private:
-	const std::string& json_;
+	std::string_view json_;
 	size_t pos_;
+	JsonParseOptions options_;
+	JsonArena* arena_;
+	JsonParseStats* stats_;
+	size_t depth_ = 0;       // Only maintained when stats are compiled in
+	size_t walk_depth_ = 0;  // Recursive-walker depth, checked against max_depth
 
 	char current() const
 	{
@@ -214,51 +1056,327 @@ private:
 
 	void skip_whitespace()
 	{
-		while (pos_ < json_.size() && std::isspace(static_cast<unsigned char>(json_[pos_]))) {
-			++pos_;
-		}
+		pos_ = scan_past_whitespace(json_, pos_);
 	}
 
+	// The DOM engine: an explicit-stack loop rather than mutual recursion,
+	// so nesting depth costs heap frames, not native stack - a hostile
+	// 50k-deep document fails the (configurable) depth check instead of
+	// overflowing, and the flat loop is friendlier to the branch predictor.
 	Json parse_value()
 	{
-		skip_whitespace();
-		char c = current();
-
-		if (c == 'n') return parse_null();
-		if (c == 't' || c == 'f') return parse_bool();
-		if (c == '"') return parse_string();
-		if (c == '[') return parse_array();
-		if (c == '{') return parse_object();
-		if (c == '-' || std::isdigit(static_cast<unsigned char>(c))) return parse_number();
-
-		throw JsonParseError("Unexpected character", pos_);
-	}
+		std::vector<BuildFrame> stack;
+		BuildNext next = BuildNext::Value;
+
+		// Pops the finished top container; returns it when it was the root
+		auto close_top = [&](Json& root) -> bool {
+			BuildFrame closed = std::move(stack.back());
+			stack.pop_back();
+			JSONPARSER_STAT(--depth_);
+			if (stack.empty()) {
+				root = std::move(closed.container);
+				return true;
+			}
+			insert_into_top(stack.back(), std::move(closed.container), next);
+			return false;
+		};
 
-	Json parse_null()
-	{
-		if (json_.substr(pos_, 4) == "null") {
-			pos_ += 4;
-			return Json(nullptr);
+		while (true) {
+			skip_whitespace();
+			switch (next) {
+			case BuildNext::Value: {
+				char c = current();
+				if (options_.lazy && !stack.empty() && (c == '[' || c == '{')) {
+					// Store the exact text span of the nested container and
+					// defer parsing it until first access
+					size_t start = pos_;
+					skip_value();
+					JsonRaw raw{ json_.substr(start, pos_ - start), options_ };
+					insert_into_top(stack.back(), Json(std::move(raw)), next);
+					continue;
+				}
+				if (c == '[' || c == '{') {
+					if (stack.size() >= options_.max_depth)
+						throw JsonParseError("Maximum nesting depth exceeded", pos_);
+					advance();
+					BuildFrame frame;
+					if (c == '[') {
+						frame.container = Json(JsonArray{ JsonArray::allocator_type(arena_) });
+						if (options_.expected_array_size)
+							frame.container.as_array().reserve(options_.expected_array_size);
+						JSONPARSER_STAT(++stats_->array_count);
+					}
+					else if (options_.flat_objects) {
+						frame.container = Json(JsonFlatObject{ JsonFlatObject::allocator_type(arena_) });
+						if (options_.expected_object_size)
+							frame.container.as_flat_object().reserve(options_.expected_object_size);
+						JSONPARSER_STAT(++stats_->object_count);
+					}
+					else {
+						frame.container = Json(JsonObject{ JsonObject::allocator_type(arena_) });
+						JSONPARSER_STAT(++stats_->object_count);
+					}
+					stack.push_back(std::move(frame));
+					JSONPARSER_STAT(if (++depth_ > stats_->max_depth) stats_->max_depth = depth_);
+
+					skip_whitespace();
+					if (c == '[' && peek() == ']') {
+						advance();
+						Json root;
+						if (close_top(root))
+							return root;
+					}
+					else if (c == '{' && peek() == '}') {
+						advance();
+						Json root;
+						if (close_top(root))
+							return root;
+					}
+					else {
+						next = c == '[' ? BuildNext::Value : BuildNext::Key;
+					}
+					continue;
+				}
+
+				Json scalar = parse_scalar(c);
+				if (stack.empty())
+					return scalar;
+				insert_into_top(stack.back(), std::move(scalar), next);
+				continue;
+			}
+
+			case BuildNext::Key: {
+				BuildFrame& top = stack.back();
+				if (peek() != '"')
+					throw JsonParseError("Expected string key in object", pos_);
+				size_t key_pos = pos_;
+				const std::string& key = parse_key(top.key_storage);
+				top.pooled_key = options_.key_pool ? &key : nullptr;
+				JSONPARSER_STAT(++stats_->key_count);
+				skip_whitespace();
+				if (peek() != ':')
+					throw JsonParseError("Expected ':' after key in object", pos_);
+				advance();
+
+				bool duplicate = false;
+				if (options_.duplicate_keys != JsonDuplicateKeys::KeepLast) {
+					if (top.container.is_flat_object())
+						duplicate = flat_find(top.container.as_flat_object(),
+							top.key_index, key) != JsonIndex::npos;
+					else
+						duplicate = container_has_key(top.container, key);
+				}
+				if (duplicate) {
+					if (options_.duplicate_keys == JsonDuplicateKeys::Error)
+						throw JsonParseError("Duplicate key in object", key_pos);
+					// KeepFirst: the duplicate's value is never parsed
+					skip_value();
+					next = BuildNext::ObjectDelim;
+					continue;
+				}
+				next = BuildNext::Value;
+				continue;
+			}
+
+			case BuildNext::ArrayDelim: {
+				if (peek() == ',') {
+					advance();
+					next = BuildNext::Value;
+					continue;
+				}
+				if (peek() == ']') {
+					advance();
+					Json root;
+					if (close_top(root))
+						return root;
+					continue;
+				}
+				throw JsonParseError("Expected ',' or ']' in array", pos_);
+			}
+
+			case BuildNext::ObjectDelim: {
+				if (peek() == ',') {
+					advance();
+					next = BuildNext::Key;
+					continue;
+				}
+				if (peek() == '}') {
+					advance();
+					Json root;
+					if (close_top(root))
+						return root;
+					continue;
+				}
+				throw JsonParseError("Expected ',' or '}' in object", pos_);
+			}
+			}
+		}
+	}
+
+	// Scalar dispatch shared with the iterative engine above
+	Json parse_scalar(char c)
+	{
+		if (c == 'n') { parse_null_raw(); return Json(nullptr); }
+		if (c == 't' || c == 'f') return Json(parse_bool_raw());
+		if (c == '"') return parse_string();
+		if (c == '-' || std::isdigit(static_cast<unsigned char>(c))) return parse_number();
+		throw JsonParseError("Unexpected character", pos_);
+	}
+
+	// One partially built container on the iterative engine's stack. The
+	// pending key is either owned by the frame (key_storage) or lives in
+	// the interning pool (pooled_key, stable storage) - never a pointer
+	// into another frame, which would dangle when the stack reallocates.
+	struct BuildFrame
+	{
+		Json container;
+		std::string key_storage;
+		const std::string* pooled_key = nullptr;
+		// Lazily built key index keeping wide flat objects O(1) per insert
+		std::unique_ptr<std::unordered_map<std::string, uint32_t>> key_index;
+
+		const std::string& pending_key() const { return pooled_key ? *pooled_key : key_storage; }
+	};
+
+	// What the grammar expects next in the iterative engine
+	enum class BuildNext { Value, Key, ArrayDelim, ObjectDelim };
+
+	static bool container_has_key(const Json& container, const std::string& key)
+	{
+		if (container.is_flat_object()) {
+			for (const auto& [entry_key, entry_value] : container.as_flat_object()) {
+				if (entry_key == key)
+					return true;
+			}
+			return false;
+		}
+		const auto& obj = container.as_object();
+		return obj.find(key) != obj.end();
+	}
+
+	// Routes a finished value into the enclosing container (keep-last on
+	// duplicate keys, matching both object representations) and sets the
+	// delimiter state the grammar expects next.
+	void insert_into_top(BuildFrame& top, Json&& completed, BuildNext& next)
+	{
+		if (top.container.is_array()) {
+			top.container.as_array().push_back(std::move(completed));
+			next = BuildNext::ArrayDelim;
+			return;
+		}
+		if (top.container.is_flat_object()) {
+			auto& obj = top.container.as_flat_object();
+			// Under a non-KeepLast policy the key was already proven absent
+			// when it was read, so the overwrite lookup would be redundant
+			size_t slot = options_.duplicate_keys == JsonDuplicateKeys::KeepLast
+				? flat_find(obj, top.key_index, top.pending_key())
+				: JsonIndex::npos;
+			if (slot != JsonIndex::npos) {
+				obj[slot].second = std::move(completed);
+			}
+			else {
+				if (top.pooled_key)
+					obj.emplace_back(*top.pooled_key, std::move(completed));
+				else
+					obj.emplace_back(std::move(top.key_storage), std::move(completed));
+				flat_register(top.key_index, obj.back().first, obj.size() - 1);
+			}
+		}
+		else {
+			auto& obj = top.container.as_object();
+			if (top.pooled_key)
+				obj.insert_or_assign(*top.pooled_key, std::move(completed));
+			else
+				obj.insert_or_assign(std::move(top.key_storage), std::move(completed));
+		}
+		next = BuildNext::ObjectDelim;
+	}
+
+	Json parse_number()
+	{
+		ParsedNumber num = parse_number_raw();
+		switch (num.kind) {
+		case ParsedNumber::Kind::Int: return Json(num.i);
+		case ParsedNumber::Kind::Uint: return Json(num.u);
+		default: return Json(num.d);
+		}
+	}
+
+	Json parse_string()
+	{
+		if (options_.string_views) {
+			std::string_view view;
+			if (try_parse_string_view(view))
+				return Json(view);
+		}
+		return Json(parse_string_raw());
+	}
+
+	// View-mode fast path: if the string contains no escapes (the common
+	// case), return a slice of the input instead of decoding a copy. Leaves
+	// pos_ untouched and returns false when an escape is found, so the
+	// caller can fall back to parse_string_raw().
+	bool try_parse_string_view(std::string_view& out)
+	{
+		if (current() != '"')
+			throw JsonParseError("Expected '\"'", pos_);
+
+		size_t scan = scan_to_string_special(json_, pos_ + 1);
+		if (scan >= json_.size())
+			throw JsonParseError("Unterminated string", pos_);
+		if (json_[scan] == '\\')
+			return false;
+
+		out = json_.substr(pos_ + 1, scan - pos_ - 1);
+		pos_ = scan + 1;
+		JSONPARSER_STAT(++stats_->string_count);
+		JSONPARSER_STAT(++stats_->string_views_taken);
+		return true;
+	}
+
+	// ----- Raw token readers shared by the DOM and SAX paths -----
+
+	void parse_null_raw()
+	{
+		if (json_.substr(pos_, 4) == "null") {
+			pos_ += 4;
+			JSONPARSER_STAT(++stats_->null_count);
+			return;
 		}
 		throw JsonParseError("Invalid null value", pos_);
 	}
 
-	Json parse_bool()
+	bool parse_bool_raw()
 	{
 		if (json_.substr(pos_, 4) == "true") {
 			pos_ += 4;
-			return Json(true);
+			JSONPARSER_STAT(++stats_->bool_count);
+			return true;
 		}
 		if (json_.substr(pos_, 5) == "false") {
 			pos_ += 5;
-			return Json(false);
+			JSONPARSER_STAT(++stats_->bool_count);
+			return false;
 		}
 		throw JsonParseError("Invalid boolean value", pos_);
 	}
 
-	Json parse_number()
+	// A number token classified while scanning: tokens without '.' or an
+	// exponent parse as int64_t (or uint64_t above INT64_MAX), everything
+	// else as double.
+	struct ParsedNumber
+	{
+		enum class Kind { Int, Uint, Double };
+		Kind kind = Kind::Double;
+		int64_t i = 0;
+		uint64_t u = 0;
+		double d = 0.0;
+	};
+
+	ParsedNumber parse_number_raw()
 	{
 		size_t start = pos_;
+		bool is_float = false;
 
 		if (peek() == '-') advance();
 
@@ -275,6 +1393,7 @@ private:
 		}
 
 		if (peek() == '.') {
+			is_float = true;
 			advance();
 			if (!std::isdigit(static_cast<unsigned char>(peek()))) {
 				throw JsonParseError("Invalid number: expected digit after decimal point", pos_);
@@ -285,6 +1404,7 @@ private:
 		}
 
 		if (peek() == 'e' || peek() == 'E') {
+			is_float = true;
 			advance();
 			if (peek() == '+' || peek() == '-') advance();
 			if (!std::isdigit(static_cast<unsigned char>(peek()))) {
@@ -295,155 +1415,1723 @@ private:
 			}
 		}
 
-		std::string num_str = json_.substr(start, pos_ - start);
-		try {
-			return Json(std::stod(num_str));
+		// The loop above has already validated the token against the JSON
+		// grammar, so convert it in place: no substring allocation, no
+		// locale involvement.
+		const char* first = json_.data() + start;
+		const char* last = json_.data() + pos_;
+		ParsedNumber num;
+		JSONPARSER_STAT_TIMER(number_seconds);
+
+		if (!is_float) {
+			// "-0" stays a double so the sign survives round-tripping
+			if (!(json_[start] == '-' && pos_ - start == 2 && json_[start + 1] == '0')) {
+				auto int_result = std::from_chars(first, last, num.i);
+				if (int_result.ec == std::errc() && int_result.ptr == last) {
+					num.kind = ParsedNumber::Kind::Int;
+					JSONPARSER_STAT(++stats_->int_count);
+					return num;
+				}
+				if (int_result.ec == std::errc::result_out_of_range && json_[start] != '-') {
+					auto uint_result = std::from_chars(first, last, num.u);
+					if (uint_result.ec == std::errc() && uint_result.ptr == last) {
+						num.kind = ParsedNumber::Kind::Uint;
+						JSONPARSER_STAT(++stats_->int_count);
+						return num;
+					}
+				}
+			}
 		}
-		catch (...) {
+
+		auto result = std::from_chars(first, last, num.d);
+		if (result.ec != std::errc() || result.ptr != last)
 			throw JsonParseError("Invalid number format", start);
-		}
+		num.kind = ParsedNumber::Kind::Double;
+		JSONPARSER_STAT(++stats_->double_count);
+		return num;
 	}
 
-	Json parse_string()
+	std::string parse_string_raw()
 	{
+		JSONPARSER_STAT_TIMER(string_seconds);
 		if (current() != '"')
 			throw JsonParseError("Expected '\"'", pos_);
 		advance();
 
 		std::string result;
-		while (pos_ < json_.size() && peek() != '"') {
-			if (peek() == '\\') {
-				advance();
-				if (pos_ >= json_.size())
-					throw JsonParseError("Unterminated string", pos_);
-
-				char escaped = peek();
-				switch (escaped) {
-				case '"': result += '"'; break;
-				case '\\': result += '\\'; break;
-				case '/': result += '/'; break;
-				case 'b': result += '\b'; break;
-				case 'f': result += '\f'; break;
-				case 'n': result += '\n'; break;
-				case 'r': result += '\r'; break;
-				case 't': result += '\t'; break;
-				case 'u': {
-					advance();
-					if (pos_ + 4 > json_.size())
-						throw JsonParseError("Invalid unicode escape", pos_);
-					std::string hex = json_.substr(pos_, 4);
-					try {
-						int code_point = std::stoi(hex, nullptr, 16);
-						if (code_point < 128) {
-							result += static_cast<char>(code_point);
-						}
-						else {
-							result += "?";
-						}
-						pos_ += 3;
-					}
-					catch (...) {
-						throw JsonParseError("Invalid unicode escape", pos_);
-					}
-					break;
-				}
-				default:
-					throw JsonParseError("Invalid escape sequence", pos_);
-				}
+		while (true) {
+			// Bulk-append the clean span up to the next quote or escape;
+			// this is where almost all string bytes go
+			size_t special = scan_to_string_special(json_, pos_);
+			if (special >= json_.size())
+				throw JsonParseError("Unterminated string", pos_);
+			result.append(json_.data() + pos_, special - pos_);
+			pos_ = special;
+
+			if (json_[pos_] == '"') {
 				advance();
+				break;
 			}
-			else {
-				result += peek();
-				advance();
+
+			// Escape sequence
+			advance();
+			if (pos_ >= json_.size())
+				throw JsonParseError("Unterminated string", pos_);
+			char escaped = json_[pos_];
+			switch (escaped) {
+			case '"': result += '"'; advance(); break;
+			case '\\': result += '\\'; advance(); break;
+			case '/': result += '/'; advance(); break;
+			case 'b': result += '\b'; advance(); break;
+			case 'f': result += '\f'; advance(); break;
+			case 'n': result += '\n'; advance(); break;
+			case 'r': result += '\r'; advance(); break;
+			case 't': result += '\t'; advance(); break;
+			case 'u':
+				decode_unicode_escape(result);
+				break;
+			default:
+				throw JsonParseError("Invalid escape sequence", pos_);
 			}
 		}
 
-		if (peek() != '"')
-			throw JsonParseError("Unterminated string", pos_);
-		advance();
+		JSONPARSER_STAT(++stats_->string_count);
+		JSONPARSER_STAT(stats_->string_bytes_copied += result.size());
+		return result;
+	}
+
+	// Decodes \uXXXX (cursor on the 'u'), including surrogate pairs, and
+	// appends the code point as UTF-8.
+	void decode_unicode_escape(std::string& out)
+	{
+		advance();  // 'u'
+		uint32_t code = 0;
+		if (!read_hex4(json_, pos_, code))
+			throw JsonParseError("Invalid unicode escape", pos_);
+		pos_ += 4;
+
+		if (code >= 0xD800 && code <= 0xDBFF) {
+			// High surrogate: the low half must follow immediately
+			if (pos_ + 1 >= json_.size() || json_[pos_] != '\\' || json_[pos_ + 1] != 'u')
+				throw JsonParseError("Invalid unicode escape: unpaired surrogate", pos_);
+			uint32_t low = 0;
+			if (!read_hex4(json_, pos_ + 2, low))
+				throw JsonParseError("Invalid unicode escape", pos_ + 2);
+			if (low < 0xDC00 || low > 0xDFFF)
+				throw JsonParseError("Invalid unicode escape: unpaired surrogate", pos_ + 2);
+			pos_ += 6;
+			code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+		}
+		else if (code >= 0xDC00 && code <= 0xDFFF) {
+			throw JsonParseError("Invalid unicode escape: unpaired surrogate", pos_ - 4);
+		}
 
-		return Json(result);
+		append_utf8(out, code);
 	}
 
-	Json parse_array()
+	// Parses a value whose expected shape is known, skipping the generic
+	// first-character dispatch: the schema picks the token reader, object
+	// keys resolve against the schema's sorted field table, and unknown
+	// keys are token-skipped so they never materialize.
+	Json parse_schema_value(const JsonSchema& schema)
 	{
-		if (current() != '[')
-			throw JsonParseError("Expected '['", pos_);
-		advance();
 		skip_whitespace();
 
-		JsonArray arr;
+		switch (schema.type()) {
+		case JsonSchema::Type::Any:
+			return parse_value();
 
-		if (peek() == ']') {
-			advance();
-			return Json(arr);
+		case JsonSchema::Type::Null:
+			parse_null_raw();
+			return Json(nullptr);
+
+		case JsonSchema::Type::Bool:
+			return Json(parse_bool_raw());
+
+		case JsonSchema::Type::Int: {
+			size_t start = pos_;
+			char c = current();
+			if (c != '-' && !std::isdigit(static_cast<unsigned char>(c)))
+				throw JsonParseError("Schema mismatch: expected integer", pos_);
+			ParsedNumber num = parse_number_raw();
+			if (num.kind == ParsedNumber::Kind::Int)
+				return Json(num.i);
+			if (num.kind == ParsedNumber::Kind::Uint)
+				return Json(num.u);
+			throw JsonParseError("Schema mismatch: expected integer", start);
 		}
 
-		while (true) {
-			arr.push_back(parse_value());
+		case JsonSchema::Type::Number: {
+			char c = current();
+			if (c != '-' && !std::isdigit(static_cast<unsigned char>(c)))
+				throw JsonParseError("Schema mismatch: expected number", pos_);
+			return parse_number();
+		}
+
+		case JsonSchema::Type::String:
+			if (current() != '"')
+				throw JsonParseError("Schema mismatch: expected string", pos_);
+			return parse_string();
+
+		case JsonSchema::Type::Array: {
+			if (current() != '[')
+				throw JsonParseError("Schema mismatch: expected array", pos_);
+			DepthGuard guard(walk_depth_, options_.max_depth, pos_);
+			advance();
 			skip_whitespace();
 
+			JsonArray arr{ JsonArray::allocator_type(arena_) };
+			if (options_.expected_array_size)
+				arr.reserve(options_.expected_array_size);
 			if (peek() == ']') {
 				advance();
-				break;
+				return Json(std::move(arr));
+			}
+			const JsonSchema& element = schema.element();
+			while (true) {
+				arr.push_back(parse_schema_value(element));
+				skip_whitespace();
+				if (peek() == ']') {
+					advance();
+					return Json(std::move(arr));
+				}
+				if (peek() != ',')
+					throw JsonParseError("Expected ',' or ']' in array", pos_);
+				advance();
+				skip_whitespace();
 			}
+		}
 
-			if (peek() != ',')
-				throw JsonParseError("Expected ',' or ']' in array", pos_);
-			advance();
-			skip_whitespace();
+		case JsonSchema::Type::Object:
+			return parse_schema_object(schema);
 		}
 
-		return Json(arr);
+		throw JsonParseError("Unexpected character", pos_);
 	}
 
-	Json parse_object()
+	Json parse_schema_object(const JsonSchema& schema)
 	{
 		if (current() != '{')
-			throw JsonParseError("Expected '{'", pos_);
+			throw JsonParseError("Schema mismatch: expected object", pos_);
+		DepthGuard guard(walk_depth_, options_.max_depth, pos_);
 		advance();
 		skip_whitespace();
 
-		JsonObject obj;
+		Json result = options_.flat_objects
+			? Json(JsonFlatObject{ JsonFlatObject::allocator_type(arena_) })
+			: Json(JsonObject{ JsonObject::allocator_type(arena_) });
+		if (options_.flat_objects && options_.expected_object_size)
+			result.as_flat_object().reserve(options_.expected_object_size);
 
 		if (peek() == '}') {
 			advance();
-			return Json(obj);
+			return result;
 		}
 
 		while (true) {
 			skip_whitespace();
-
 			if (peek() != '"')
 				throw JsonParseError("Expected string key in object", pos_);
 
-			std::string key = parse_string().as_string();
+			std::string key_storage;
+			const std::string& key = parse_key(key_storage);
 			skip_whitespace();
-
 			if (peek() != ':')
 				throw JsonParseError("Expected ':' after key in object", pos_);
 			advance();
 			skip_whitespace();
 
-			obj[key] = parse_value();
+			const JsonSchema* field = schema.find_field(key);
+			if (!field) {
+				if (!schema.skip_unknown())
+					throw JsonParseError("Schema mismatch: unexpected key \"" + key + "\"", pos_);
+				skip_value();
+			}
+			else if (options_.duplicate_keys != JsonDuplicateKeys::KeepLast
+				&& container_has_key(result, key)) {
+				if (options_.duplicate_keys == JsonDuplicateKeys::Error)
+					throw JsonParseError("Duplicate key in object", pos_);
+				skip_value();  // KeepFirst
+			}
+			else if (options_.flat_objects) {
+				// Keep-last on duplicate keys, matching the generic engine
+				auto& obj = result.as_flat_object();
+				Json parsed = parse_schema_value(*field);
+				bool replaced = false;
+				for (auto& [entry_key, entry_value] : obj) {
+					if (entry_key == key) {
+						entry_value = std::move(parsed);
+						replaced = true;
+						break;
+					}
+				}
+				if (!replaced) {
+					if (options_.key_pool)
+						obj.emplace_back(key, std::move(parsed));
+					else
+						obj.emplace_back(std::move(key_storage), std::move(parsed));
+				}
+			}
+			else {
+				auto& obj = result.as_object();
+				if (options_.key_pool)
+					obj.insert_or_assign(key, parse_schema_value(*field));
+				else
+					obj.insert_or_assign(std::move(key_storage), parse_schema_value(*field));
+			}
 			skip_whitespace();
 
 			if (peek() == '}') {
 				advance();
-				break;
+				return result;
+			}
+			if (peek() != ',')
+				throw JsonParseError("Expected ',' or '}' in object", pos_);
+			advance();
+		}
+	}
+
+	// Reads an object key. With a pool attached, escape-free keys are
+	// interned straight from their raw bytes - after the first occurrence a
+	// repeated field name costs one hash lookup, no decode - and the
+	// returned reference is the pooled string. Without a pool the key is
+	// decoded into `owned` and that is returned.
+	const std::string& parse_key(std::string& owned)
+	{
+		if (options_.key_pool) {
+			std::string_view raw;
+			if (try_parse_string_view(raw))
+				return options_.key_pool->intern(raw);
+			return options_.key_pool->intern(parse_string_raw());
+		}
+		owned = parse_string_raw();
+		return owned;
+	}
+
+	// Guards the recursive walkers (SAX, skipping) with the same nesting
+	// limit the iterative engine enforces
+	struct DepthGuard
+	{
+		size_t& depth;
+		DepthGuard(size_t& d, size_t limit, size_t pos) : depth(d)
+		{
+			if (++depth > limit)
+				throw JsonParseError("Maximum nesting depth exceeded", pos);
+		}
+		~DepthGuard() { --depth; }
+	};
+
+	// ----- Skipping: token-level traversal without materializing values -----
+
+	// Skips over a complete string without decoding it
+	void skip_string()
+	{
+		if (current() != '"')
+			throw JsonParseError("Expected '\"'", pos_);
+		size_t scan = pos_ + 1;
+		while (true) {
+			scan = scan_to_string_special(json_, scan);
+			if (scan >= json_.size())
+				throw JsonParseError("Unterminated string", pos_);
+			if (json_[scan] == '"') {
+				pos_ = scan + 1;
+				return;
+			}
+			scan += 2;  // Backslash plus the escaped character
+		}
+	}
+
+	// Skips over one complete value of any type
+	void skip_value()
+	{
+		skip_whitespace();
+		char c = current();
+
+		if (c == 'n') { parse_null_raw(); return; }
+		if (c == 't' || c == 'f') { parse_bool_raw(); return; }
+		if (c == '"') { skip_string(); return; }
+		if (c == '-' || std::isdigit(static_cast<unsigned char>(c))) { parse_number_raw(); return; }
+
+		if (c == '[') {
+			DepthGuard guard(walk_depth_, options_.max_depth, pos_);
+			advance();
+			skip_whitespace();
+			if (peek() == ']') {
+				advance();
+				return;
+			}
+			while (true) {
+				skip_value();
+				skip_whitespace();
+				if (peek() == ']') {
+					advance();
+					return;
+				}
+				if (peek() != ',')
+					throw JsonParseError("Expected ',' or ']' in array", pos_);
+				advance();
+			}
+		}
+
+		if (c == '{') {
+			DepthGuard guard(walk_depth_, options_.max_depth, pos_);
+			advance();
+			skip_whitespace();
+			if (peek() == '}') {
+				advance();
+				return;
+			}
+			while (true) {
+				skip_whitespace();
+				if (peek() != '"')
+					throw JsonParseError("Expected string key in object", pos_);
+				skip_string();
+				skip_whitespace();
+				if (peek() != ':')
+					throw JsonParseError("Expected ':' after key in object", pos_);
+				advance();
+				skip_value();
+				skip_whitespace();
+				if (peek() == '}') {
+					advance();
+					return;
+				}
+				if (peek() != ',')
+					throw JsonParseError("Expected ',' or '}' in object", pos_);
+				advance();
 			}
+		}
+
+		throw JsonParseError("Unexpected character", pos_);
+	}
+
+	// Positions the cursor on the value of the member named token, skipping
+	// the members before it. Returns false when the object has no such key.
+	bool descend_into_object_member(const std::string& token)
+	{
+		advance();  // '{'
+		skip_whitespace();
+		if (peek() == '}')
+			return false;
+
+		while (true) {
+			skip_whitespace();
+			if (peek() != '"')
+				throw JsonParseError("Expected string key in object", pos_);
+			std::string key = parse_string_raw();
+			skip_whitespace();
+			if (peek() != ':')
+				throw JsonParseError("Expected ':' after key in object", pos_);
+			advance();
+
+			if (key == token)
+				return true;
 
+			skip_value();
+			skip_whitespace();
+			if (peek() == '}')
+				return false;
 			if (peek() != ',')
 				throw JsonParseError("Expected ',' or '}' in object", pos_);
 			advance();
 		}
+	}
+
+	// Positions the cursor on the array element at index, skipping the
+	// elements before it. Returns false when the array is too short.
+	bool descend_into_array_element(size_t index)
+	{
+		advance();  // '['
+		skip_whitespace();
+		if (peek() == ']')
+			return false;
 
-		return Json(obj);
+		for (size_t i = 0; i < index; ++i) {
+			skip_value();
+			skip_whitespace();
+			if (peek() == ']')
+				return false;
+			if (peek() != ',')
+				throw JsonParseError("Expected ',' or ']' in array", pos_);
+			advance();
+		}
+		return true;
 	}
-};
 
-Json Json::parse(const std::string& json_string)
-{
-	JsonParser parser(json_string);
-	return parser.parse();
+	// ----- SAX walkers: mirror the parse_* productions, but emit events -----
+
+	bool sax_value(JsonSaxHandler& handler)
+	{
+		skip_whitespace();
+		char c = current();
+
+		if (c == 'n') { parse_null_raw(); return handler.on_null(); }
+		if (c == 't' || c == 'f') return handler.on_bool(parse_bool_raw());
+		if (c == '"') return handler.on_string(parse_string_raw());
+		if (c == '[') return sax_array(handler);
+		if (c == '{') return sax_object(handler);
+		if (c == '-' || std::isdigit(static_cast<unsigned char>(c))) {
+			ParsedNumber num = parse_number_raw();
+			switch (num.kind) {
+			case ParsedNumber::Kind::Int: return handler.on_int(num.i);
+			case ParsedNumber::Kind::Uint: return handler.on_uint(num.u);
+			default: return handler.on_number(num.d);
+			}
+		}
+
+		throw JsonParseError("Unexpected character", pos_);
+	}
+
+	bool sax_array(JsonSaxHandler& handler)
+	{
+		if (current() != '[')
+			throw JsonParseError("Expected '['", pos_);
+		DepthGuard guard(walk_depth_, options_.max_depth, pos_);
+		advance();
+		skip_whitespace();
+
+		if (!handler.on_begin_array())
+			return false;
+
+		if (peek() == ']') {
+			advance();
+			return handler.on_end_array();
+		}
+
+		while (true) {
+			if (!sax_value(handler))
+				return false;
+			skip_whitespace();
+
+			if (peek() == ']') {
+				advance();
+				break;
+			}
+
+			if (peek() != ',')
+				throw JsonParseError("Expected ',' or ']' in array", pos_);
+			advance();
+			skip_whitespace();
+		}
+
+		return handler.on_end_array();
+	}
+
+	bool sax_object(JsonSaxHandler& handler)
+	{
+		if (current() != '{')
+			throw JsonParseError("Expected '{'", pos_);
+		DepthGuard guard(walk_depth_, options_.max_depth, pos_);
+		advance();
+		skip_whitespace();
+
+		if (!handler.on_begin_object())
+			return false;
+
+		if (peek() == '}') {
+			advance();
+			return handler.on_end_object();
+		}
+
+		while (true) {
+			skip_whitespace();
+
+			if (peek() != '"')
+				throw JsonParseError("Expected string key in object", pos_);
+
+			std::string key = parse_string_raw();
+			skip_whitespace();
+
+			if (peek() != ':')
+				throw JsonParseError("Expected ':' after key in object", pos_);
+			advance();
+			skip_whitespace();
+
+			if (!handler.on_key(key))
+				return false;
+			if (!sax_value(handler))
+				return false;
+			skip_whitespace();
+
+			if (peek() == '}') {
+				advance();
+				break;
+			}
+
+			if (peek() != ',')
+				throw JsonParseError("Expected ',' or '}' in object", pos_);
+			advance();
+		}
+
+		return handler.on_end_object();
+	}
+};
+
+// ========== Validation ==========
+
+// Non-throwing, non-building validator: the same grammar as the parser run
+// as a flat loop with a byte-per-level container stack. No per-node work
+// happens, error reporting fills a JsonError with a static message, and the
+// only allocation is the container stack's single reservation.
+namespace {
+
+class JsonValidator
+{
+public:
+	// With a tape attached, every validated value (and object key) is also
+	// recorded as a JsonIndex entry with its text span and skip link.
+	JsonValidator(std::string_view text, const JsonParseOptions& options,
+		std::vector<JsonIndex::Entry>* tape = nullptr)
+		: text_(text), options_(options), tape_(tape)
+	{
+		// The fixed block covers the default depth limit without touching
+		// the heap; only a raised limit allocates (once)
+		if (options.max_depth > sizeof(fixed_levels_)) {
+			spill_levels_.resize(options.max_depth);
+			levels_ = spill_levels_.data();
+		}
+		else {
+			levels_ = fixed_levels_;
+		}
+	}
+
+	bool run(JsonError& error)
+	{
+		pos_ = scan_past_whitespace(text_, 0);
+		if (!check_value(error))
+			return false;
+
+		while (depth_ != 0) {
+			pos_ = scan_past_whitespace(text_, pos_);
+			if (pos_ >= text_.size())
+				return fail(error, JsonErrc::UnexpectedEnd, "Unexpected end of input");
+
+			char c = text_[pos_];
+			bool in_array = levels_[depth_ - 1] == '[';
+			if (c == ',') {
+				++pos_;
+				pos_ = scan_past_whitespace(text_, pos_);
+				if (in_array) {
+					if (!check_value(error))
+						return false;
+				}
+				else if (!check_member(error)) {
+					return false;
+				}
+			}
+			else if (c == (in_array ? ']' : '}')) {
+				++pos_;
+				--depth_;
+				if (tape_)
+					close_tape_entry();
+				if (!in_array && reject_duplicates())
+					object_keys_.pop_back();
+			}
+			else {
+				return fail(error,
+					in_array ? JsonErrc::ExpectedCommaOrCloseArray : JsonErrc::ExpectedCommaOrCloseObject,
+					in_array ? "Expected ',' or ']' in array" : "Expected ',' or '}' in object");
+			}
+		}
+
+		pos_ = scan_past_whitespace(text_, pos_);
+		if (pos_ < text_.size())
+			return fail(error, JsonErrc::TrailingCharacters, "Unexpected characters after JSON value");
+		return true;
+	}
+
+private:
+	bool fail(JsonError& error, JsonErrc code, const char* message)
+	{
+		error.code = code;
+		error.message = message;
+		error.position = pos_;
+		return false;
+	}
+
+	// Validates one value; containers push a stack level and return with
+	// the opener consumed (an immediately empty container is closed here)
+	bool check_value(JsonError& error)
+	{
+		if (pos_ >= text_.size())
+			return fail(error, JsonErrc::UnexpectedEnd, "Unexpected end of input");
+
+		char c = text_[pos_];
+		size_t start = pos_;
+		if (c == '[' || c == '{') {
+			if (depth_ >= options_.max_depth)
+				return fail(error, JsonErrc::DepthExceeded, "Maximum nesting depth exceeded");
+			++pos_;
+			levels_[depth_++] = c;
+			if (tape_) {
+				open_entries_.push_back(tape_->size());
+				tape_->push_back(JsonIndex::Entry{ start, 0, 0,
+					c == '[' ? JsonIndex::Kind::Array : JsonIndex::Kind::Object });
+			}
+			if (c == '{' && reject_duplicates())
+				object_keys_.emplace_back();
+			pos_ = scan_past_whitespace(text_, pos_);
+			if (pos_ < text_.size() && text_[pos_] == (c == '[' ? ']' : '}')) {
+				++pos_;
+				--depth_;
+				if (tape_)
+					close_tape_entry();
+				if (c == '{' && reject_duplicates())
+					object_keys_.pop_back();
+				return true;
+			}
+			if (c == '{')
+				return check_member(error);
+			return check_value(error);
+		}
+		if (c == '"') {
+			if (!check_string(error))
+				return false;
+			record(JsonIndex::Kind::String, start);
+			return true;
+		}
+		if (c == '-' || (c >= '0' && c <= '9')) {
+			if (!check_number(error))
+				return false;
+			record(JsonIndex::Kind::Number, start);
+			return true;
+		}
+		if (c == 't' || c == 'f' || c == 'n') {
+			if (!check_literal(error, c == 't' ? "true" : c == 'f' ? "false" : "null"))
+				return false;
+			record(c == 't' ? JsonIndex::Kind::True
+				: c == 'f' ? JsonIndex::Kind::False : JsonIndex::Kind::Null, start);
+			return true;
+		}
+		return fail(error, JsonErrc::UnexpectedCharacter, "Unexpected character");
+	}
+
+	bool check_member(JsonError& error)
+	{
+		if (pos_ >= text_.size() || text_[pos_] != '"')
+			return fail(error, JsonErrc::ExpectedKey, "Expected string key in object");
+		size_t key_start = pos_ + 1;
+		if (!check_string(error))
+			return false;
+		if (tape_)
+			tape_->push_back(JsonIndex::Entry{ key_start, pos_ - 1, tape_->size() + 1,
+				JsonIndex::Kind::Key });
+		if (reject_duplicates()) {
+			std::string_view raw = text_.substr(key_start, pos_ - 1 - key_start);
+			std::string key = raw.find('\\') == std::string_view::npos
+				? std::string(raw) : decode_string_span(raw);
+			auto& keys = object_keys_.back();
+			if (!keys.insert(std::move(key)).second) {
+				pos_ = key_start - 1;
+				return fail(error, JsonErrc::DuplicateKey, "Duplicate key in object");
+			}
+		}
+		pos_ = scan_past_whitespace(text_, pos_);
+		if (pos_ >= text_.size() || text_[pos_] != ':')
+			return fail(error, JsonErrc::ExpectedColon, "Expected ':' after key in object");
+		++pos_;
+		pos_ = scan_past_whitespace(text_, pos_);
+		return check_value(error);
+	}
+
+	bool check_string(JsonError& error)
+	{
+		size_t scan = pos_ + 1;
+		while (true) {
+			scan = scan_to_string_special(text_, scan);
+			if (scan >= text_.size())
+				return fail(error, JsonErrc::UnterminatedString, "Unterminated string");
+			if (text_[scan] == '"') {
+				pos_ = scan + 1;
+				return true;
+			}
+			// Escape sequence
+			if (scan + 1 >= text_.size())
+				return fail(error, JsonErrc::UnterminatedString, "Unterminated string");
+			char escaped = text_[scan + 1];
+			if (escaped == 'u') {
+				uint32_t code = 0;
+				if (!read_hex4(text_, scan + 2, code))
+					return fail(error, JsonErrc::InvalidUnicodeEscape, "Invalid unicode escape");
+				scan += 6;
+				if (code >= 0xD800 && code <= 0xDBFF) {
+					uint32_t low = 0;
+					if (scan + 6 > text_.size() || text_[scan] != '\\' || text_[scan + 1] != 'u'
+						|| !read_hex4(text_, scan + 2, low) || low < 0xDC00 || low > 0xDFFF)
+						return fail(error, JsonErrc::InvalidUnicodeEscape, "Invalid unicode escape: unpaired surrogate");
+					scan += 6;
+				}
+				else if (code >= 0xDC00 && code <= 0xDFFF) {
+					return fail(error, JsonErrc::InvalidUnicodeEscape, "Invalid unicode escape: unpaired surrogate");
+				}
+			}
+			else if (escaped == '"' || escaped == '\\' || escaped == '/' || escaped == 'b'
+				|| escaped == 'f' || escaped == 'n' || escaped == 'r' || escaped == 't') {
+				scan += 2;
+			}
+			else {
+				pos_ = scan + 1;
+				return fail(error, JsonErrc::InvalidEscape, "Invalid escape sequence");
+			}
+		}
+	}
+
+	bool check_number(JsonError& error)
+	{
+		size_t start = pos_;
+		if (text_[pos_] == '-')
+			++pos_;
+		if (pos_ >= text_.size())
+			return fail(error, JsonErrc::InvalidNumber, "Invalid number");
+		if (text_[pos_] == '0') {
+			++pos_;
+		}
+		else if (text_[pos_] >= '1' && text_[pos_] <= '9') {
+			while (pos_ < text_.size() && text_[pos_] >= '0' && text_[pos_] <= '9')
+				++pos_;
+		}
+		else {
+			return fail(error, JsonErrc::InvalidNumber, "Invalid number");
+		}
+		if (pos_ < text_.size() && text_[pos_] == '.') {
+			++pos_;
+			if (pos_ >= text_.size() || text_[pos_] < '0' || text_[pos_] > '9')
+				return fail(error, JsonErrc::InvalidNumber, "Invalid number: expected digit after decimal point");
+			while (pos_ < text_.size() && text_[pos_] >= '0' && text_[pos_] <= '9')
+				++pos_;
+		}
+		if (pos_ < text_.size() && (text_[pos_] == 'e' || text_[pos_] == 'E')) {
+			++pos_;
+			if (pos_ < text_.size() && (text_[pos_] == '+' || text_[pos_] == '-'))
+				++pos_;
+			if (pos_ >= text_.size() || text_[pos_] < '0' || text_[pos_] > '9')
+				return fail(error, JsonErrc::InvalidNumber, "Invalid number: expected digit in exponent");
+			while (pos_ < text_.size() && text_[pos_] >= '0' && text_[pos_] <= '9')
+				++pos_;
+		}
+
+		// Out-of-range values fail at parse time, so they fail here too;
+		// from_chars does not allocate
+		double parsed = 0.0;
+		auto result = std::from_chars(text_.data() + start, text_.data() + pos_, parsed);
+		if (result.ec != std::errc() || result.ptr != text_.data() + pos_) {
+			pos_ = start;
+			return fail(error, JsonErrc::InvalidNumber, "Invalid number format");
+		}
+		return true;
+	}
+
+	bool check_literal(JsonError& error, std::string_view literal)
+	{
+		if (text_.substr(pos_, literal.size()) != literal)
+			return fail(error, JsonErrc::InvalidLiteral,
+				literal[0] == 'n' ? "Invalid null value" : "Invalid boolean value");
+		pos_ += literal.size();
+		return true;
+	}
+
+	// The duplicate policy is only enforced here when the parser would
+	// reject the document; KeepFirst/KeepLast never throw for duplicates
+	bool reject_duplicates() const
+	{
+		return options_.duplicate_keys == JsonDuplicateKeys::Error;
+	}
+
+	void record(JsonIndex::Kind kind, size_t begin)
+	{
+		if (tape_)
+			tape_->push_back(JsonIndex::Entry{ begin, pos_, tape_->size() + 1, kind });
+	}
+
+	void close_tape_entry()
+	{
+		size_t idx = open_entries_.back();
+		open_entries_.pop_back();
+		(*tape_)[idx].end = pos_;
+		(*tape_)[idx].next = tape_->size();
+	}
+
+	std::string_view text_;
+	const JsonParseOptions& options_;
+	size_t pos_ = 0;
+	char fixed_levels_[1024];
+	std::vector<char> spill_levels_;
+	char* levels_ = nullptr;
+	size_t depth_ = 0;
+	std::vector<JsonIndex::Entry>* tape_;
+	std::vector<size_t> open_entries_;
+	// One key set per open object, used only under duplicate_keys == Error
+	std::vector<std::set<std::string>> object_keys_;
+};
+
+}  // namespace
+
+bool Json::validate(std::string_view json_text, JsonError* error,
+	const JsonParseOptions& options)
+{
+	JsonError local;
+	JsonValidator validator(json_text, options);
+	bool ok = validator.run(error ? *error : local);
+	if (ok && error)
+		*error = JsonError();
+	return ok;
+}
+
+bool Json::try_parse(std::string_view json_text, Json& out, JsonError& error,
+	const JsonParseOptions& options)
+{
+	// The allocation-free validator gatekeeps: malformed input costs one
+	// scan and a POD error, and never reaches the throwing engine. Valid
+	// input pays the scan too, but validation is token-level only - a
+	// small fraction of the tree-building parse that follows. The validator
+	// also enforces the duplicate_keys == Error policy, so a rejecting
+	// document fails here; the catch below is a safety net keeping the
+	// non-throwing contract if the validator and engine ever disagree.
+	if (!validate(json_text, &error, options))
+		return false;
+	try {
+		out = parse(json_text, options);
+	}
+	catch (const JsonParseError& parse_error) {
+		error.code = JsonErrc::ParseFailed;
+		error.message = "JSON parse failed after validation";
+		error.position = parse_error.position();
+		return false;
+	}
+	error = JsonError();
+	return true;
+}
+
+// ========== Structural Index (Tape) ==========
+
+JsonIndex JsonIndex::build(std::string_view json_text, const JsonParseOptions& options)
+{
+	JsonIndex index;
+	JsonError error;
+	JsonValidator validator(json_text, options, &index.entries_);
+	if (!validator.run(error))
+		throw JsonParseError(error.message, error.position);
+	return index;
+}
+
+size_t JsonIndex::resolve(std::string_view json_text, std::string_view pointer) const
+{
+	if (entries_.empty())
+		return npos;
+
+	size_t current = 0;
+	while (!pointer.empty()) {
+		if (pointer[0] != '/')
+			throw std::runtime_error("Invalid JSON pointer: must start with '/'");
+		std::string token = take_pointer_token(pointer);
+		const Entry& entry = entries_[current];
+
+		if (entry.kind == Kind::Array) {
+			size_t want = 0;
+			if (!pointer_token_to_index(token, want))
+				return npos;
+			size_t child = current + 1;
+			for (size_t i = 0; i < want && child < entry.next; ++i)
+				child = entries_[child].next;
+			if (child >= entry.next)
+				return npos;
+			current = child;
+		}
+		else if (entry.kind == Kind::Object) {
+			size_t child = current + 1;  // First Key entry
+			bool found = false;
+			while (child < entry.next) {
+				const Entry& key = entries_[child];
+				std::string_view raw = json_text.substr(key.begin, key.end - key.begin);
+				bool match;
+				if (raw.find('\\') == std::string_view::npos) {
+					match = raw == token;
+				}
+				else {
+					// Rare: the key itself contains escapes - decode it
+					std::string quoted;
+					quoted.reserve(raw.size() + 2);
+					quoted += '"';
+					quoted.append(raw);
+					quoted += '"';
+					match = Json::parse(quoted).as_string() == token;
+				}
+				if (match) {
+					current = child + 1;  // The key's value entry
+					found = true;
+					break;
+				}
+				child = entries_[child + 1].next;  // Skip the value subtree
+			}
+			if (!found)
+				return npos;
+		}
+		else {
+			return npos;
+		}
+	}
+	return current;
+}
+
+bool JsonIndex::extract_pointer(std::string_view json_text, std::string_view pointer,
+	Json& out, const JsonParseOptions& options) const
+{
+	size_t entry = resolve(json_text, pointer);
+	if (entry == npos)
+		return false;
+	out = Json::parse(span(entry, json_text), options);
+	return true;
+}
+
+// ========== Streaming Push Parser ==========
+
+void JsonStreamParser::feed(const char* data, size_t size)
+{
+	buffer_.append(data, size);
+	process();
+	// Drop consumed bytes so the buffer only ever holds a partial-token tail
+	if (pos_ > 0) {
+		base_offset_ += pos_;
+		buffer_.erase(0, pos_);
+		pos_ = 0;
+	}
+}
+
+Json JsonStreamParser::finish()
+{
+	// A number token at end of stream has no delimiter; end of input is one
+	if (mode_ == Mode::InNumber)
+		finalize_number();
+
+	if (mode_ != Mode::Done || !stack_.empty())
+		throw JsonParseError("Unexpected end of input", absolute(pos_));
+
+	Json result = std::move(root_);
+	reset();
+	return result;
+}
+
+void JsonStreamParser::reset()
+{
+	buffer_.clear();
+	pos_ = 0;
+	base_offset_ = 0;
+	mode_ = Mode::ExpectValue;
+	stack_.clear();
+	str_buf_.clear();
+	str_is_key_ = false;
+	str_in_escape_ = false;
+	num_buf_.clear();
+	num_start_ = 0;
+	root_ = Json();
+}
+
+void JsonStreamParser::process()
+{
+	while (true) {
+		if (mode_ == Mode::InString) {
+			if (!process_string())
+				return;
+			continue;
+		}
+		if (mode_ == Mode::InNumber) {
+			if (!process_number())
+				return;
+			continue;
+		}
+
+		pos_ = scan_past_whitespace(buffer_, pos_);
+		if (mode_ == Mode::Done) {
+			if (pos_ < buffer_.size())
+				throw JsonParseError("Unexpected characters after JSON value", absolute(pos_));
+			return;
+		}
+		if (pos_ >= buffer_.size())
+			return;
+
+		char c = buffer_[pos_];
+		switch (mode_) {
+		case Mode::ExpectValue:
+			if (!dispatch_value(c))
+				return;
+			break;
+
+		case Mode::ExpectValueOrEnd:
+			if (c == ']') {
+				++pos_;
+				Frame closed = std::move(stack_.back());
+				stack_.pop_back();
+				complete_value(std::move(closed.container));
+			}
+			else if (!dispatch_value(c)) {
+				return;
+			}
+			break;
+
+		case Mode::ExpectKeyOrEnd:
+		case Mode::ExpectKey:
+			if (c == '"') {
+				++pos_;
+				str_buf_.clear();
+				str_in_escape_ = false;
+				str_is_key_ = true;
+				mode_ = Mode::InString;
+			}
+			else if (c == '}' && mode_ == Mode::ExpectKeyOrEnd) {
+				++pos_;
+				Frame closed = std::move(stack_.back());
+				stack_.pop_back();
+				complete_value(std::move(closed.container));
+			}
+			else {
+				throw JsonParseError("Expected string key in object", absolute(pos_));
+			}
+			break;
+
+		case Mode::ExpectColon:
+			if (c != ':')
+				throw JsonParseError("Expected ':' after key in object", absolute(pos_));
+			++pos_;
+			mode_ = Mode::ExpectValue;
+			break;
+
+		case Mode::ExpectCommaOrEndArray:
+			if (c == ',') {
+				++pos_;
+				mode_ = Mode::ExpectValue;
+			}
+			else if (c == ']') {
+				++pos_;
+				Frame closed = std::move(stack_.back());
+				stack_.pop_back();
+				complete_value(std::move(closed.container));
+			}
+			else {
+				throw JsonParseError("Expected ',' or ']' in array", absolute(pos_));
+			}
+			break;
+
+		case Mode::ExpectCommaOrEndObject:
+			if (c == ',') {
+				++pos_;
+				mode_ = Mode::ExpectKey;
+			}
+			else if (c == '}') {
+				++pos_;
+				Frame closed = std::move(stack_.back());
+				stack_.pop_back();
+				complete_value(std::move(closed.container));
+			}
+			else {
+				throw JsonParseError("Expected ',' or '}' in object", absolute(pos_));
+			}
+			break;
+
+		default:
+			return;
+		}
+	}
+}
+
+// Dispatches on a value's first character. Returns false when the buffer
+// ends inside a literal that may still complete with the next chunk.
+bool JsonStreamParser::dispatch_value(char c)
+{
+	if (c == '{') {
+		if (stack_.size() >= options_.max_depth)
+			throw JsonParseError("Maximum nesting depth exceeded", absolute(pos_));
+		++pos_;
+		Frame frame;
+		frame.container = options_.flat_objects ? Json(JsonFlatObject{}) : Json(JsonObject{});
+		stack_.push_back(std::move(frame));
+		mode_ = Mode::ExpectKeyOrEnd;
+		return true;
+	}
+	if (c == '[') {
+		if (stack_.size() >= options_.max_depth)
+			throw JsonParseError("Maximum nesting depth exceeded", absolute(pos_));
+		++pos_;
+		Frame frame;
+		frame.container = Json(JsonArray{});
+		if (options_.expected_array_size)
+			frame.container.as_array().reserve(options_.expected_array_size);
+		stack_.push_back(std::move(frame));
+		mode_ = Mode::ExpectValueOrEnd;
+		return true;
+	}
+	if (c == '"') {
+		++pos_;
+		str_buf_.clear();
+		str_in_escape_ = false;
+		str_is_key_ = false;
+		mode_ = Mode::InString;
+		return true;
+	}
+	if (c == 't' || c == 'f' || c == 'n') {
+		std::string_view target = c == 't' ? std::string_view("true")
+			: c == 'f' ? std::string_view("false") : std::string_view("null");
+		std::string_view rest = std::string_view(buffer_).substr(pos_);
+		if (rest.size() < target.size()) {
+			if (target.substr(0, rest.size()) == rest)
+				return false;  // Literal may complete in the next chunk
+			throw JsonParseError(c == 'n' ? "Invalid null value" : "Invalid boolean value", absolute(pos_));
+		}
+		if (rest.substr(0, target.size()) != target)
+			throw JsonParseError(c == 'n' ? "Invalid null value" : "Invalid boolean value", absolute(pos_));
+		pos_ += target.size();
+		complete_value(c == 't' ? Json(true) : c == 'f' ? Json(false) : Json(nullptr));
+		return true;
+	}
+	if (c == '-' || std::isdigit(static_cast<unsigned char>(c))) {
+		num_buf_.clear();
+		num_start_ = absolute(pos_);
+		mode_ = Mode::InNumber;
+		return true;
+	}
+	throw JsonParseError("Unexpected character", absolute(pos_));
+}
+
+// Decodes string content until the closing quote, suspending (return false)
+// when the buffer ends mid-string or mid-escape.
+bool JsonStreamParser::process_string()
+{
+	while (true) {
+		if (str_in_escape_) {
+			if (pos_ >= buffer_.size())
+				return false;
+			char escaped = buffer_[pos_];
+			switch (escaped) {
+			case '"': str_buf_ += '"'; ++pos_; break;
+			case '\\': str_buf_ += '\\'; ++pos_; break;
+			case '/': str_buf_ += '/'; ++pos_; break;
+			case 'b': str_buf_ += '\b'; ++pos_; break;
+			case 'f': str_buf_ += '\f'; ++pos_; break;
+			case 'n': str_buf_ += '\n'; ++pos_; break;
+			case 'r': str_buf_ += '\r'; ++pos_; break;
+			case 't': str_buf_ += '\t'; ++pos_; break;
+			case 'u': {
+				// 'u' plus four hex digits must be available together
+				if (buffer_.size() - pos_ < 5)
+					return false;
+				uint32_t code = 0;
+				if (!read_hex4(buffer_, pos_ + 1, code))
+					throw JsonParseError("Invalid unicode escape", absolute(pos_ + 1));
+				if (code >= 0xD800 && code <= 0xDBFF) {
+					// High surrogate: wait until the whole low half is here
+					if (buffer_.size() - pos_ < 11)
+						return false;
+					if (buffer_[pos_ + 5] != '\\' || buffer_[pos_ + 6] != 'u')
+						throw JsonParseError("Invalid unicode escape: unpaired surrogate", absolute(pos_ + 5));
+					uint32_t low = 0;
+					if (!read_hex4(buffer_, pos_ + 7, low))
+						throw JsonParseError("Invalid unicode escape", absolute(pos_ + 7));
+					if (low < 0xDC00 || low > 0xDFFF)
+						throw JsonParseError("Invalid unicode escape: unpaired surrogate", absolute(pos_ + 7));
+					code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+					pos_ += 11;
+				}
+				else if (code >= 0xDC00 && code <= 0xDFFF) {
+					throw JsonParseError("Invalid unicode escape: unpaired surrogate", absolute(pos_ + 1));
+				}
+				else {
+					pos_ += 5;
+				}
+				append_utf8(str_buf_, code);
+				break;
+			}
+			default:
+				throw JsonParseError("Invalid escape sequence", absolute(pos_));
+			}
+			str_in_escape_ = false;
+			continue;
+		}
+
+		size_t special = scan_to_string_special(buffer_, pos_);
+		str_buf_.append(buffer_, pos_, special - pos_);
+		pos_ = special;
+		if (pos_ >= buffer_.size())
+			return false;
+
+		if (buffer_[pos_] == '"') {
+			++pos_;
+			if (str_is_key_) {
+				stack_.back().pending_key = std::move(str_buf_);
+				str_buf_.clear();
+				mode_ = Mode::ExpectColon;
+			}
+			else {
+				complete_value(Json(std::move(str_buf_)));
+				str_buf_.clear();
+			}
+			return true;
+		}
+
+		// Backslash: the escaped character may be in the next chunk
+		++pos_;
+		str_in_escape_ = true;
+	}
+}
+
+// Accumulates number characters; the token only ends at a delimiter (or at
+// finish(), which calls finalize_number directly).
+bool JsonStreamParser::process_number()
+{
+	while (pos_ < buffer_.size()) {
+		char c = buffer_[pos_];
+		if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E') {
+			num_buf_ += c;
+			++pos_;
+		}
+		else {
+			break;
+		}
+	}
+	if (pos_ >= buffer_.size())
+		return false;
+	finalize_number();
+	return true;
+}
+
+void JsonStreamParser::finalize_number()
+{
+	// The accumulated token is a complete standalone value; reuse the batch
+	// parser for grammar validation and int/uint/double classification
+	try {
+		JsonParser parser(num_buf_);
+		complete_value(parser.parse());
+	}
+	catch (const JsonParseError&) {
+		throw JsonParseError("Invalid number format", num_start_);
+	}
+	num_buf_.clear();
+}
+
+// Routes a finished value into the enclosing container, or makes it the
+// root, and sets the mode the grammar expects next.
+void JsonStreamParser::complete_value(Json&& completed)
+{
+	if (stack_.empty()) {
+		root_ = std::move(completed);
+		mode_ = Mode::Done;
+		return;
+	}
+
+	Frame& top = stack_.back();
+	if (top.container.is_array()) {
+		top.container.as_array().push_back(std::move(completed));
+		mode_ = Mode::ExpectCommaOrEndArray;
+		return;
+	}
+	if (top.container.is_flat_object()) {
+		auto& obj = top.container.as_flat_object();
+		size_t slot = flat_find(obj, top.key_index, top.pending_key);
+		if (slot != JsonIndex::npos) {
+			if (options_.duplicate_keys == JsonDuplicateKeys::Error)
+				throw JsonParseError("Duplicate key in object", absolute(pos_));
+			if (options_.duplicate_keys == JsonDuplicateKeys::KeepLast)
+				obj[slot].second = std::move(completed);
+			// KeepFirst: drop the later value
+		}
+		else {
+			size_t next_slot = obj.size();
+			obj.emplace_back(std::move(top.pending_key), std::move(completed));
+			flat_register(top.key_index, obj.back().first, next_slot);
+		}
+	}
+	else {
+		auto& obj = top.container.as_object();
+		if (options_.duplicate_keys == JsonDuplicateKeys::KeepLast) {
+			obj.insert_or_assign(std::move(top.pending_key), std::move(completed));
+		}
+		else {
+			auto [it, inserted] = obj.emplace(std::move(top.pending_key), std::move(completed));
+			if (!inserted && options_.duplicate_keys == JsonDuplicateKeys::Error)
+				throw JsonParseError("Duplicate key in object", absolute(pos_));
+		}
+	}
+	top.pending_key.clear();
+	mode_ = Mode::ExpectCommaOrEndObject;
+}
+
+// ========== JSON Lines (NDJSON) ==========
+
+JsonLinesReader::JsonLinesReader(std::string_view text, JsonParseOptions options)
+	: text_(text), options_(options), arena_(std::make_unique<JsonArena>())
+{
+	// Strings view the input buffer, which outlives the reader by contract
+	options_.string_views = true;
+}
+
+JsonLinesReader JsonLinesReader::from_file(const char* path, JsonParseOptions options)
+{
+	JsonLinesReader reader(std::string_view(), options);
+	reader.mapping_ = JsonMappedFile(path);
+	reader.text_ = reader.mapping_.view();
+	return reader;
+}
+
+bool JsonLinesReader::next(Json& out)
+{
+	while (pos_ < text_.size()) {
+		size_t eol = text_.find('\n', pos_);
+		size_t end = eol == std::string_view::npos ? text_.size() : eol;
+		std::string_view line = text_.substr(pos_, end - pos_);
+		if (!line.empty() && line.back() == '\r')
+			line.remove_suffix(1);
+		pos_ = eol == std::string_view::npos ? text_.size() : eol + 1;
+		++line_;
+
+		if (scan_past_whitespace(line, 0) == line.size())
+			continue;  // Blank line
+
+		// Drop the previous record before rewinding the arena its
+		// containers live in, then reuse the arena for this line
+		out = Json();
+		arena_->reset();
+		JsonParser parser(line, options_, arena_.get());
+		out = parser.parse();
+		return true;
+	}
+	return false;
+}
+
+// ========== Memory-Mapped Files ==========
+
+JsonMappedFile::JsonMappedFile(const char* path)
+{
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		throw std::runtime_error(std::string("Cannot open file: ") + path);
+
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(file, &file_size)) {
+		CloseHandle(file);
+		throw std::runtime_error(std::string("Cannot stat file: ") + path);
+	}
+	if (file_size.QuadPart == 0) {
+		// Empty files cannot be mapped; an empty view is fine
+		CloseHandle(file);
+		return;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping) {
+		CloseHandle(file);
+		throw std::runtime_error(std::string("Cannot map file: ") + path);
+	}
+
+	const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!data) {
+		CloseHandle(mapping);
+		CloseHandle(file);
+		throw std::runtime_error(std::string("Cannot map file: ") + path);
+	}
+
+	file_handle_ = file;
+	mapping_handle_ = mapping;
+	data_ = static_cast<const char*>(data);
+	size_ = static_cast<size_t>(file_size.QuadPart);
+#else
+	int fd = ::open(path, O_RDONLY);
+	if (fd < 0)
+		throw std::runtime_error(std::string("Cannot open file: ") + path);
+
+	struct stat st;
+	if (fstat(fd, &st) != 0) {
+		::close(fd);
+		throw std::runtime_error(std::string("Cannot stat file: ") + path);
+	}
+	if (st.st_size == 0) {
+		::close(fd);
+		return;
+	}
+
+	void* data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);  // The mapping keeps the file referenced
+	if (data == MAP_FAILED)
+		throw std::runtime_error(std::string("Cannot map file: ") + path);
+
+	data_ = static_cast<const char*>(data);
+	size_ = static_cast<size_t>(st.st_size);
+#endif
+}
+
+JsonMappedFile::~JsonMappedFile()
+{
+	close();
+}
+
+JsonMappedFile::JsonMappedFile(JsonMappedFile&& other) noexcept
+	: data_(other.data_), size_(other.size_),
+	file_handle_(other.file_handle_), mapping_handle_(other.mapping_handle_)
+{
+	other.data_ = nullptr;
+	other.size_ = 0;
+	other.file_handle_ = nullptr;
+	other.mapping_handle_ = nullptr;
+}
+
+JsonMappedFile& JsonMappedFile::operator=(JsonMappedFile&& other) noexcept
+{
+	if (this != &other) {
+		close();
+		data_ = other.data_;
+		size_ = other.size_;
+		file_handle_ = other.file_handle_;
+		mapping_handle_ = other.mapping_handle_;
+		other.data_ = nullptr;
+		other.size_ = 0;
+		other.file_handle_ = nullptr;
+		other.mapping_handle_ = nullptr;
+	}
+	return *this;
+}
+
+void JsonMappedFile::close()
+{
+	if (!data_)
+		return;
+#ifdef _WIN32
+	UnmapViewOfFile(data_);
+	CloseHandle(mapping_handle_);
+	CloseHandle(file_handle_);
+#else
+	munmap(const_cast<char*>(data_), size_);
+#endif
+	data_ = nullptr;
+	size_ = 0;
+	file_handle_ = nullptr;
+	mapping_handle_ = nullptr;
+}
+
+Json Json::parse(const std::string& json_string)
+{
+	JsonParser parser(json_string);
+	return parser.parse();
+}
+
+Json Json::parse(std::string_view json_text, const JsonParseOptions& options)
+{
+	JsonParser parser(json_text, options);
+	return parser.parse();
+}
+
+Json Json::parse(std::string_view json_text, const JsonSchema& schema,
+	const JsonParseOptions& options)
+{
+	JsonParser parser(json_text, options);
+	return parser.parse(schema);
+}
+
+Json Json::parse_file(const char* path)
+{
+	JsonMappedFile file(path);
+	JsonParser parser(file.view());
+	return parser.parse();
+}
+
+Json Json::parse_view(std::string_view json_text)
+{
+	JsonParser parser(json_text, JsonParseOptions{ .string_views = true });
+	return parser.parse();
+}
+
+Json Json::parse_with_stats(std::string_view json_text, JsonParseStats& stats,
+	const JsonParseOptions& options)
+{
+	stats = JsonParseStats();
+#ifdef JSONPARSER_ENABLE_STATS
+	stats.detailed = true;
+#endif
+
+	auto start = std::chrono::steady_clock::now();
+	JsonParser parser(json_text, options, nullptr, &stats);
+	Json result = parser.parse();
+	stats.total_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return result;
+}
+
+bool Json::extract_pointer(std::string_view json_text, std::string_view pointer,
+	Json& out, const JsonParseOptions& options)
+{
+	JsonParser parser(json_text, options);
+	return parser.extract_pointer(pointer, out);
+}
+
+// ========== Parallel Parsing ==========
+
+// Structural pre-pass: locates the [begin, end) text range of every
+// top-level element of a root array without tokenizing values. Returns
+// false when the input is not a well-formed-enough root array, in which
+// case the caller should use the sequential parser (and get its precise
+// error reporting).
+static bool find_root_array_elements(std::string_view text,
+	std::vector<std::pair<size_t, size_t>>& elements)
+{
+	size_t i = scan_past_whitespace(text, 0);
+	if (i >= text.size() || text[i] != '[')
+		return false;
+	++i;
+
+	size_t depth = 1;
+	size_t element_start = i;
+	bool saw_comma = false;
+
+	while (i < text.size()) {
+		char c = text[i];
+		if (c == '"') {
+			// Skip the whole string, honoring escapes
+			++i;
+			while (true) {
+				i = scan_to_string_special(text, i);
+				if (i >= text.size())
+					return false;
+				if (text[i] == '"') {
+					++i;
+					break;
+				}
+				i += 2;  // Backslash plus the escaped character
+			}
+			continue;
+		}
+		if (c == '[' || c == '{') {
+			++depth;
+		}
+		else if (c == ']' || c == '}') {
+			if (depth == 0)
+				return false;
+			--depth;
+			if (depth == 0) {
+				if (c != ']')
+					return false;
+				// Close the final element; it may be absent only for an
+				// empty array - "[1,]" has to reach the sequential parser
+				// so the trailing comma is rejected
+				if (scan_past_whitespace(text, element_start) < i)
+					elements.emplace_back(element_start, i);
+				else if (saw_comma)
+					return false;
+				// Only trailing whitespace may follow the root array
+				return scan_past_whitespace(text, i + 1) == text.size();
+			}
+		}
+		else if (c == ',' && depth == 1) {
+			saw_comma = true;
+			elements.emplace_back(element_start, i);
+			element_start = i + 1;
+		}
+		++i;
+	}
+	return false;
+}
+
+Json Json::parse_parallel(std::string_view json_text, unsigned n_threads,
+	const JsonParseOptions& options)
+{
+	if (n_threads == 0) {
+		n_threads = std::thread::hardware_concurrency();
+		if (n_threads == 0)
+			n_threads = 1;
+	}
+
+	std::vector<std::pair<size_t, size_t>> elements;
+	// Not worth the pre-pass and thread startup below ~1 MB or when there
+	// is no parallelism to be had
+	if (n_threads > 1 && json_text.size() >= (1u << 20)
+		&& find_root_array_elements(json_text, elements)
+		&& elements.size() >= n_threads * 2) {
+
+		std::vector<Json> results(elements.size());
+		std::vector<std::exception_ptr> errors(n_threads);
+		std::vector<std::thread> workers;
+		workers.reserve(n_threads);
+
+		const size_t per_thread = (elements.size() + n_threads - 1) / n_threads;
+		for (unsigned t = 0; t < n_threads; ++t) {
+			workers.emplace_back([&, t]() {
+				try {
+					size_t first = static_cast<size_t>(t) * per_thread;
+					size_t last = first + per_thread < elements.size()
+						? first + per_thread : elements.size();
+					for (size_t e = first; e < last; ++e) {
+						auto [begin, end] = elements[e];
+						try {
+							JsonParser parser(json_text.substr(begin, end - begin), options);
+							results[e] = parser.parse();
+						}
+						catch (const JsonParseError& element_error) {
+							// Positions are slice-relative inside the worker;
+							// fold the element's document offset back in
+							throw JsonParseError(element_error.message(),
+								element_error.position() + begin);
+						}
+					}
+				}
+				catch (...) {
+					errors[t] = std::current_exception();
+				}
+			});
+		}
+		for (auto& worker : workers)
+			worker.join();
+		for (auto& error : errors) {
+			if (error)
+				std::rethrow_exception(error);
+		}
+
+		JsonArray root;
+		root.reserve(results.size());
+		for (auto& result : results)
+			root.push_back(std::move(result));
+		return Json(std::move(root));
+	}
+
+	return Json::parse(json_text, options);
+}
+
+JsonSharedDoc JsonSharedDoc::parse(std::string_view json_text, const JsonParseOptions& options)
+{
+	return JsonSharedDoc(Json::parse(json_text, options));
+}
+
+JsonDocument JsonDocument::parse(std::string_view json_text, JsonParseOptions options)
+{
+	JsonDocument doc;
+
+	// Copy the input into the arena so string views in the tree stay valid
+	// for the document's whole lifetime.
+	if (!json_text.empty()) {
+		char* copy = static_cast<char*>(doc.arena_->allocate(json_text.size(), 1));
+		std::memcpy(copy, json_text.data(), json_text.size());
+		doc.text_ = std::string_view(copy, json_text.size());
+	}
+
+	// Views must point into the arena-held copy, never the caller's buffer
+	options.string_views = true;
+
+	JsonParser parser(doc.text_, options, doc.arena_.get());
+	doc.root_ = parser.parse();
+	return doc;
+}
+
+JsonDocument JsonDocument::from_file(const char* path, JsonParseOptions options)
+{
+	JsonDocument doc;
+	doc.mapping_ = JsonMappedFile(path);
+	doc.text_ = doc.mapping_.view();
+
+	// Views point into the mapping, which the document keeps alive
+	options.string_views = true;
+
+	JsonParser parser(doc.text_, options, doc.arena_.get());
+	doc.root_ = parser.parse();
+	return doc;
+}
+
+bool Json::sax_parse(std::string_view json_text, JsonSaxHandler& handler)
+{
+	JsonParser parser(json_text);
+	return parser.parse(handler);
 }
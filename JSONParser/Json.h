@@ -1,18 +1,412 @@
 #pragma once
 
 #include <iostream>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <string_view>
 #include <vector>
 #include <map>
+#include <memory>
 #include <variant>
 #include <stdexcept>
 #include <sstream>
 
 struct Json;
 
-using JsonArray = std::vector<Json>;
-using JsonObject = std::map<std::string, Json>;
-using JsonValue = std::variant<std::nullptr_t, bool, double, std::string, JsonArray, JsonObject>;
+// Bump-pointer arena: hands out memory from large blocks and frees everything
+// at once when destroyed. A parsed document allocated from one arena is a few
+// contiguous regions instead of one heap allocation per node.
+class JsonArena
+{
+public:
+	static constexpr size_t kDefaultBlockSize = 64 * 1024;
+
+	JsonArena() = default;
+	JsonArena(const JsonArena&) = delete;
+	JsonArena& operator=(const JsonArena&) = delete;
+
+	void* allocate(size_t size, size_t align)
+	{
+		size_t misalign = reinterpret_cast<uintptr_t>(cursor_) & (align - 1);
+		size_t padding = misalign ? align - misalign : 0;
+		if (padding + size > remaining_) {
+			new_block(size + align);
+			misalign = reinterpret_cast<uintptr_t>(cursor_) & (align - 1);
+			padding = misalign ? align - misalign : 0;
+		}
+		char* result = cursor_ + padding;
+		cursor_ = result + size;
+		remaining_ -= padding + size;
+		return result;
+	}
+
+	// Rewinds the arena for reuse: every pointer handed out becomes invalid.
+	// The first block is kept so a reset arena serves the next allocation
+	// without going back to the heap.
+	void reset()
+	{
+		if (blocks_.size() > 1)
+			blocks_.resize(1);
+		if (!blocks_.empty()) {
+			cursor_ = blocks_.front().data.get();
+			remaining_ = blocks_.front().size;
+		}
+	}
+
+	size_t bytes_allocated() const
+	{
+		size_t total = 0;
+		for (const auto& block : blocks_)
+			total += block.size;
+		return total;
+	}
+
+private:
+	struct Block
+	{
+		std::unique_ptr<char[]> data;
+		size_t size;
+	};
+
+	void new_block(size_t min_size)
+	{
+		size_t block_size = min_size > kDefaultBlockSize ? min_size : kDefaultBlockSize;
+		blocks_.push_back(Block{ std::make_unique<char[]>(block_size), block_size });
+		cursor_ = blocks_.back().data.get();
+		remaining_ = block_size;
+	}
+
+	std::vector<Block> blocks_;
+	char* cursor_ = nullptr;
+	size_t remaining_ = 0;
+};
+
+// Allocator used by the Json containers. Without an arena it forwards to the
+// heap, so default-constructed containers behave exactly as before; with one,
+// all container storage comes from the arena and deallocation is a no-op.
+template <typename T>
+class JsonArenaAllocator
+{
+public:
+	using value_type = T;
+
+	JsonArenaAllocator() noexcept : arena_(nullptr) {}
+	explicit JsonArenaAllocator(JsonArena* arena) noexcept : arena_(arena) {}
+	template <typename U>
+	JsonArenaAllocator(const JsonArenaAllocator<U>& other) noexcept : arena_(other.arena()) {}
+
+	T* allocate(size_t n)
+	{
+		if (arena_)
+			return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+		return static_cast<T*>(::operator new(n * sizeof(T)));
+	}
+
+	void deallocate(T* p, size_t) noexcept
+	{
+		if (!arena_)
+			::operator delete(p);
+	}
+
+	// Container copies detach from the arena: copying a value out of a
+	// JsonDocument gives an ordinary heap-backed tree.
+	JsonArenaAllocator select_on_container_copy_construction() const noexcept
+	{
+		return JsonArenaAllocator();
+	}
+
+	JsonArena* arena() const noexcept { return arena_; }
+
+private:
+	JsonArena* arena_;
+};
+
+template <typename T, typename U>
+bool operator==(const JsonArenaAllocator<T>& a, const JsonArenaAllocator<U>& b) noexcept
+{
+	return a.arena() == b.arena();
+}
+
+template <typename T, typename U>
+bool operator!=(const JsonArenaAllocator<T>& a, const JsonArenaAllocator<U>& b) noexcept
+{
+	return !(a == b);
+}
+
+using JsonArray = std::vector<Json, JsonArenaAllocator<Json>>;
+using JsonObject = std::map<std::string, Json, std::less<std::string>,
+	JsonArenaAllocator<std::pair<const std::string, Json>>>;
+// Flat object representation: contiguous key/value pairs in insertion order.
+// Lookups are a linear scan, which beats the red-black tree for the typical
+// 5-50 key object and keeps iteration (and serialized output) in the order
+// the document was written. The parse-side duplicate handling is not bound
+// by that assumption: once an object outgrows a small threshold the parser
+// switches to a per-object hash index, so hostile or merely huge objects
+// stay O(n) to build.
+using JsonFlatObject = std::vector<std::pair<std::string, Json>,
+	JsonArenaAllocator<std::pair<std::string, Json>>>;
+
+// Heap box with value semantics: copying the box deep-copies the value,
+// moving transfers it. Large variant alternatives are boxed so they don't
+// inflate every Json node - sizeof(Json) is paid by a million-element array
+// of numbers just as much as by one object.
+template <typename T>
+class JsonBox
+{
+public:
+	JsonBox() : ptr_(std::make_unique<T>()) {}
+	JsonBox(const T& v) : ptr_(std::make_unique<T>(v)) {}
+	JsonBox(T&& v) : ptr_(std::make_unique<T>(std::move(v))) {}
+	JsonBox(const JsonBox& other) : ptr_(std::make_unique<T>(*other.ptr_)) {}
+	JsonBox(JsonBox&&) noexcept = default;
+	JsonBox& operator=(const JsonBox& other)
+	{
+		if (this != &other)
+			ptr_ = std::make_unique<T>(*other.ptr_);
+		return *this;
+	}
+	JsonBox& operator=(JsonBox&&) noexcept = default;
+
+	T& operator*() { return *ptr_; }
+	const T& operator*() const { return *ptr_; }
+
+private:
+	std::unique_ptr<T> ptr_;
+};
+
+class JsonKeyPool;
+
+// Error codes for the non-throwing entry points
+enum class JsonErrc : uint8_t
+{
+	None = 0,
+	UnexpectedCharacter,
+	UnexpectedEnd,
+	TrailingCharacters,
+	ExpectedKey,
+	ExpectedColon,
+	ExpectedCommaOrCloseArray,
+	ExpectedCommaOrCloseObject,
+	UnterminatedString,
+	InvalidEscape,
+	InvalidUnicodeEscape,
+	InvalidNumber,
+	InvalidLiteral,
+	DepthExceeded,
+	DuplicateKey,
+	ParseFailed,  // Safety net: the engine failed after validation passed
+};
+
+// Plain error record for the non-throwing entry points: a code, a static
+// message (never allocated) and the byte position - the same information
+// JsonParseError carries, without the exception machinery.
+struct JsonError
+{
+	JsonErrc code = JsonErrc::None;
+	const char* message = nullptr;  // Static string; nullptr means no error
+	size_t position = 0;
+
+	explicit operator bool() const { return code != JsonErrc::None; }
+};
+
+// What the parser does when an object repeats a key
+enum class JsonDuplicateKeys : uint8_t
+{
+	KeepLast,   // Later occurrences overwrite (historical operator[] behavior)
+	KeepFirst,  // The duplicate's value is skipped without being parsed
+	Error,      // The document is rejected with "Duplicate key in object"
+};
+
+// Options controlling how the parser builds the tree
+struct JsonParseOptions
+{
+	// Escape-free string values become std::string_view slices into the
+	// input buffer (see Json::parse_view)
+	bool string_views = false;
+	// Objects are built as insertion-ordered JsonFlatObject instead of
+	// std::map - faster for parse-once/read-many workloads and preserves
+	// key order in output
+	bool flat_objects = false;
+	// Object keys are interned through this pool (see JsonKeyPool); the
+	// pool must outlive the parse
+	JsonKeyPool* key_pool = nullptr;
+	// Containers may nest this deep before parsing fails with a
+	// JsonParseError ("Maximum nesting depth exceeded"). The DOM engine
+	// itself is iterative, so the limit exists to bound downstream
+	// consumers (tree destruction, serialization frames, recursive user
+	// walks), not the parser's own stack.
+	size_t max_depth = 1000;
+	// Nested containers are stored as unparsed JsonRaw text spans and only
+	// parsed on first access (one level at a time). The input buffer must
+	// outlive the tree, as with string_views.
+	bool lazy = false;
+	// Duplicate-key handling for objects (see JsonDuplicateKeys)
+	JsonDuplicateKeys duplicate_keys = JsonDuplicateKeys::KeepLast;
+	// Capacity hints, applied to every array / flat object the parser
+	// opens: on large homogeneous arrays a right-sized hint removes all
+	// growth reallocations. 0 means no hint.
+	size_t expected_array_size = 0;
+	size_t expected_object_size = 0;
+};
+
+// An unparsed subtree held by a lazily parsed tree: the exact text span of
+// the value plus the options it should eventually be parsed with.
+struct JsonRaw
+{
+	std::string_view text;
+	JsonParseOptions options;
+};
+
+// std::map is by far the largest alternative (48 bytes under libstdc++), so
+// it is stored boxed; everything else stays inline. Short owned strings are
+// already inline via the small-string optimization, and in view/document
+// mode strings are 16-byte std::string_views.
+using JsonValue = std::variant<std::nullptr_t, bool, int64_t, uint64_t, double, std::string, std::string_view, JsonArray, JsonBox<JsonObject>, JsonFlatObject, JsonBox<JsonRaw>>;
+
+// Parse-time statistics, populated by Json::parse_with_stats. The detailed
+// counters cost cycles in the hottest loops, so they are compiled in only
+// when the build defines JSONPARSER_ENABLE_STATS; without it the counting
+// code does not exist (zero overhead), only total_seconds is filled, and
+// `detailed` stays false. Token counts include tokens traversed by the
+// skipping paths (extract_pointer), not just materialized values.
+struct JsonParseStats
+{
+	bool detailed = false;
+
+	// Tokens by type
+	size_t null_count = 0;
+	size_t bool_count = 0;
+	size_t int_count = 0;
+	size_t double_count = 0;
+	size_t string_count = 0;
+	size_t key_count = 0;
+	size_t array_count = 0;
+	size_t object_count = 0;
+
+	size_t string_bytes_copied = 0;  // Bytes decoded into owned strings
+	size_t string_views_taken = 0;   // Strings stored as zero-copy views
+	size_t max_depth = 0;            // Deepest container nesting reached
+
+	// Phase timing; container-build time is roughly
+	// total - number_seconds - string_seconds
+	double total_seconds = 0.0;
+	double number_seconds = 0.0;
+	double string_seconds = 0.0;
+};
+
+// Interning pool for object keys. Record streams repeat the same handful of
+// field names millions of times; with a pool attached (JsonParseOptions::
+// key_pool) each distinct key is decoded and hashed once, after which
+// occurrences are recognized straight from their raw bytes - escape
+// processing included - and object entries copy the pooled string (a no-op
+// allocation-wise for names short enough for the small-string buffer).
+// Thread-safe, so one pool can serve parsers on many threads, and reusable
+// across any number of Json::parse calls or JsonLinesReader lines.
+class JsonKeyPool
+{
+public:
+	// Returns a stable reference to the pooled copy of key; the reference
+	// stays valid as long as the pool lives.
+	const std::string& intern(std::string_view key);
+
+	// Number of distinct keys seen
+	size_t size() const;
+
+private:
+	mutable std::mutex mutex_;
+	std::deque<std::string> storage_;
+	std::unordered_map<std::string_view, const std::string*> index_;
+};
+
+// Output formatting for the serializer. Floats always print in shortest
+// round-trip form (stable bytes for a given value), so canonical output for
+// byte-level diffing just adds sort_keys; indentation is configurable and
+// written in bulk from a cached indent table.
+struct JsonFormat
+{
+	bool pretty = false;
+	int indent_width = 2;       // Spaces (or indent_chars) per level
+	char indent_char = ' ';
+	// Canonical mode: object members serialize in sorted key order
+	// regardless of representation, so equal documents produce equal bytes
+	bool sort_keys = false;
+};
+
+// Describes the fixed document shape an endpoint expects, built once at
+// startup and handed to the parser. With a schema the per-value dispatch on
+// the first character disappears (the expected type selects the token
+// reader directly), object keys match against a sorted field table, and
+// unknown keys are skipped at token level without materializing anything.
+//
+//   static const JsonSchema kEvent = JsonSchema::object({
+//       {"id", JsonSchema(JsonSchema::Type::Int)},
+//       {"name", JsonSchema(JsonSchema::Type::String)},
+//       {"tags", JsonSchema::array(JsonSchema(JsonSchema::Type::String))},
+//   });
+//   Json event = Json::parse(text, kEvent);
+//
+// A value that does not match the schema throws JsonParseError
+// ("Schema mismatch ..."). Type::Any falls back to the generic parser for
+// that subtree.
+class JsonSchema
+{
+public:
+	enum class Type { Any, Null, Bool, Int, Number, String, Array, Object };
+
+	JsonSchema(Type type = Type::Any) : type_(type) {}
+
+	// An object with a fixed key set; unknown keys are token-skipped when
+	// skip_unknown is true, rejected otherwise
+	static JsonSchema object(std::vector<std::pair<std::string, JsonSchema>> fields,
+		bool skip_unknown = true)
+	{
+		JsonSchema schema(Type::Object);
+		schema.fields_ = std::move(fields);
+		std::sort(schema.fields_.begin(), schema.fields_.end(),
+			[](const auto& a, const auto& b) { return a.first < b.first; });
+		schema.skip_unknown_ = skip_unknown;
+		return schema;
+	}
+
+	// An array whose elements all match element
+	static JsonSchema array(JsonSchema element)
+	{
+		JsonSchema schema(Type::Array);
+		schema.element_ = std::make_shared<JsonSchema>(std::move(element));
+		return schema;
+	}
+
+	Type type() const { return type_; }
+	bool skip_unknown() const { return skip_unknown_; }
+
+	// Binary search over the sorted field table; nullptr when absent
+	const JsonSchema* find_field(std::string_view key) const
+	{
+		auto it = std::lower_bound(fields_.begin(), fields_.end(), key,
+			[](const auto& field, std::string_view k) { return field.first < k; });
+		if (it != fields_.end() && it->first == key)
+			return &it->second;
+		return nullptr;
+	}
+
+	const JsonSchema& element() const
+	{
+		static const JsonSchema any;
+		return element_ ? *element_ : any;
+	}
+
+private:
+	Type type_;
+	std::vector<std::pair<std::string, JsonSchema>> fields_;
+	std::shared_ptr<JsonSchema> element_;
+	bool skip_unknown_ = true;
+};
 
 struct Json
 {
@@ -23,33 +417,66 @@ struct Json
 	Json(std::nullptr_t) : value(nullptr) {}
 	Json(bool b) : value(b) {}
 	Json(double d) : value(d) {}
-	Json(int i) : value(double(i)) {}
+	Json(int i) : value(int64_t(i)) {}
+	Json(int64_t i) : value(i) {}
+	Json(uint64_t u) : value(u) {}
 	Json(const char* s) : value(std::string(s)) {}
 	Json(const std::string& s) : value(s) {}
 	Json(std::string&& s) : value(std::move(s)) {}
+	Json(std::string_view sv) : value(sv) {}
 	Json(const JsonArray& a) : value(a) {}
 	Json(JsonArray&& a) : value(std::move(a)) {}
-	Json(const JsonObject& o) : value(o) {}
-	Json(JsonObject&& o) : value(std::move(o)) {}
+	Json(const JsonObject& o) : value(JsonBox<JsonObject>(o)) {}
+	Json(JsonObject&& o) : value(JsonBox<JsonObject>(std::move(o))) {}
+	Json(const JsonFlatObject& o) : value(o) {}
+	Json(JsonFlatObject&& o) : value(std::move(o)) {}
+	Json(JsonRaw&& r) : value(JsonBox<JsonRaw>(std::move(r))) {}
 
 	// Type checkers
 	bool is_null() const { return std::holds_alternative<std::nullptr_t>(value); }
 	bool is_bool() const { return std::holds_alternative<bool>(value); }
-	bool is_number() const { return std::holds_alternative<double>(value); }
-	bool is_string() const { return std::holds_alternative<std::string>(value); }
+	bool is_number() const
+	{
+		return std::holds_alternative<double>(value)
+			|| std::holds_alternative<int64_t>(value)
+			|| std::holds_alternative<uint64_t>(value);
+	}
+	bool is_int() const { return std::holds_alternative<int64_t>(value) || std::holds_alternative<uint64_t>(value); }
+	bool is_uint() const { return std::holds_alternative<uint64_t>(value); }
+	bool is_double() const { return std::holds_alternative<double>(value); }
+	bool is_string() const { return std::holds_alternative<std::string>(value) || std::holds_alternative<std::string_view>(value); }
+	bool is_string_view() const { return std::holds_alternative<std::string_view>(value); }
 	bool is_array() const { return std::holds_alternative<JsonArray>(value); }
-	bool is_object() const { return std::holds_alternative<JsonObject>(value); }
+	bool is_object() const { return std::holds_alternative<JsonBox<JsonObject>>(value) || std::holds_alternative<JsonFlatObject>(value); }
+	bool is_flat_object() const { return std::holds_alternative<JsonFlatObject>(value); }
+	// An unparsed lazy subtree (see JsonParseOptions::lazy)
+	bool is_raw() const { return std::holds_alternative<JsonBox<JsonRaw>>(value); }
 
-	// Getters with type checking
+	// Getters with type checking. as_number() converts integer values to
+	// double; as_int()/as_uint() are exact and throw when the stored value
+	// does not fit the requested type.
 	bool as_bool() const;
 	double as_number() const;
+	int64_t as_int() const;
+	uint64_t as_uint() const;
 	const std::string& as_string() const;
+	// Works for both owned strings and string views
+	std::string_view as_string_view() const;
 	const JsonArray& as_array() const;
 	const JsonObject& as_object() const;
+	const JsonFlatObject& as_flat_object() const;
+
+	const JsonRaw& as_raw() const;
 
 	// Non-const getters
 	JsonArray& as_array();
 	JsonObject& as_object();
+	JsonFlatObject& as_flat_object();
+
+	// Parses a lazy subtree in place (no-op for anything else). Non-const
+	// operator[] does this automatically; const access to a raw value
+	// throws instead.
+	void materialize();
 
 	// Array/Object access operators
 	Json& operator[](size_t index);
@@ -57,11 +484,513 @@ struct Json
 	Json& operator[](const std::string& key);
 	const Json& operator[](const std::string& key) const;
 
-	// Serialization
+	// Compact binary serialization for cached documents: one tag byte per
+	// value, varint lengths/counts, native-endian 8-byte ints and doubles,
+	// length-prefixed string bytes - no re-tokenization, no number
+	// conversion. Decoding is a near-memcpy walk, an order of magnitude
+	// faster than re-parsing text, and is only suitable between processes
+	// that share the format (and endianness). Both object representations
+	// round-trip as themselves; with options.string_views the decoded tree
+	// views into `data`, which must then outlive it.
+	void to_binary(std::string& out) const;
+	static Json from_binary(std::string_view data, const JsonParseOptions& options = {});
+
+	// JSON Pointer (RFC 6901) navigation over the parsed tree, e.g.
+	// json.at_pointer("/data/user/posts/0/likes"). "" addresses the whole
+	// document; ~0 and ~1 decode to '~' and '/'. Throws std::runtime_error
+	// when the pointer does not resolve.
+	const Json& at_pointer(std::string_view pointer) const;
+
+	// Serialization. stringify_to appends into a single caller-provided
+	// buffer reused across the whole tree; stringify is a thin wrapper that
+	// returns the buffer.
 	std::string stringify(bool pretty = false, int indent = 0) const;
+	std::string stringify(const JsonFormat& format) const;
+	void stringify_to(std::string& out, bool pretty = false, int indent = 0) const;
+	void stringify_to(std::string& out, const JsonFormat& format) const;
 
 	// Parsing
 	static Json parse(const std::string& json_string);
+	static Json parse(std::string_view json_text, const JsonParseOptions& options);
+
+	// Schema-guided parsing: the expected shape replaces generic dispatch
+	// and unknown keys never materialize (see JsonSchema)
+	static Json parse(std::string_view json_text, const JsonSchema& schema,
+		const JsonParseOptions& options = {});
+
+	// Validation without building anything: runs the parser's state machine
+	// over the text with no per-node work and, under the default
+	// duplicate-key policy, no allocations on either outcome. With
+	// duplicate_keys == Error it also tracks object keys (which allocates)
+	// so duplicate-rejecting documents fail here rather than in the
+	// throwing engine. On failure the optional error record carries a code,
+	// a static message and the byte position, like JsonParseError does.
+	static bool validate(std::string_view json_text, JsonError* error = nullptr,
+		const JsonParseOptions& options = {});
+
+	// Non-throwing parse for workloads where malformed input is routine
+	// (truncated uploads, firehose ingestion): the allocation-free
+	// validator gatekeeps, so bad documents cost one scan and a POD error -
+	// no unwinding, no message allocation - and never reach the throwing
+	// engine. Returns false and fills error on failure; out is only
+	// assigned on success.
+	static bool try_parse(std::string_view json_text, Json& out, JsonError& error,
+		const JsonParseOptions& options = {});
+
+	// Parses while collecting statistics into stats (reset first). Use this
+	// to decide which documents belong on the streaming engine vs the DOM -
+	// see JsonParseStats for what is collected and the build flag that
+	// enables the detailed counters.
+	static Json parse_with_stats(std::string_view json_text, JsonParseStats& stats,
+		const JsonParseOptions& options = {});
+
+	// Zero-copy parsing: string values without escape sequences are stored as
+	// std::string_view slices into the caller's buffer instead of owned
+	// copies. The buffer must outlive the returned Json tree.
+	static Json parse_view(std::string_view json_text);
+
+	// Parses a file by memory-mapping it - the file's bytes are never copied
+	// into an intermediate std::string. The returned tree owns its strings;
+	// for a zero-copy tree over the mapping use JsonDocument::from_file.
+	static Json parse_file(const char* path);
+
+	// Runs a JSON Pointer directly against raw text: container levels are
+	// navigated token by token, non-matching subtrees are skipped without
+	// materializing anything, and parsing stops the moment the target has
+	// been extracted - for a few fields out of a huge document this is far
+	// cheaper than parsing the tree first. Returns false when the pointer
+	// does not resolve. Note: text after the target is never validated.
+	static bool extract_pointer(std::string_view json_text, std::string_view pointer,
+		Json& out, const JsonParseOptions& options = {});
+
+	// Parallel parsing for large documents whose root is an array: a
+	// structural pre-pass finds the top-level element boundaries, the
+	// elements are parsed on n_threads worker threads (0 = hardware
+	// concurrency), and the results are stitched together in order. Inputs
+	// that are not a root array, are small, or are structurally malformed
+	// fall back to the sequential parser. Errors always carry positions
+	// relative to the whole document - worker failures are rethrown with
+	// the failing element's offset folded in. With options.string_views the
+	// caller's buffer must outlive the tree, as with parse_view.
+	static Json parse_parallel(std::string_view json_text, unsigned n_threads = 0,
+		const JsonParseOptions& options = {});
+
+	// Streaming (SAX-style) parsing: walks the document and fires events on
+	// the handler without building a DOM tree. Returns false if the handler
+	// stopped the parse early, true if the whole document was consumed.
+	static bool sax_parse(std::string_view json_text, class JsonSaxHandler& handler);
+};
+
+// Streaming serializer: writes a tree through a pluggable sink, batching
+// output in an internal buffer that flushes in chunks, so a multi-GB export
+// never exists in memory as one string. The traversal keeps an explicit
+// stack instead of recursing, so arbitrarily deep trees cannot overflow the
+// native stack. Output is byte-identical to stringify(), which is now the
+// convenience wrapper over a string sink.
+class JsonWriter
+{
+public:
+	// Receives each flushed chunk of output
+	class Sink
+	{
+	public:
+		virtual ~Sink() = default;
+		virtual void write(const char* data, size_t size) = 0;
+	};
+
+	static constexpr size_t kDefaultFlushThreshold = 64 * 1024;
+
+	explicit JsonWriter(Sink& sink, size_t flush_threshold = kDefaultFlushThreshold)
+		: sink_(sink), flush_threshold_(flush_threshold) {}
+	~JsonWriter() { flush(); }
+
+	JsonWriter(const JsonWriter&) = delete;
+	JsonWriter& operator=(const JsonWriter&) = delete;
+
+	// Serializes value through the sink (flushes any buffered tail)
+	void write(const Json& value, bool pretty = false, int indent = 0)
+	{
+		JsonFormat format;
+		format.pretty = pretty;
+		write(value, format, indent);
+	}
+	void write(const Json& value, const JsonFormat& format, int base_depth = 0);
+
+	// Pushes whatever is buffered out to the sink
+	void flush()
+	{
+		if (!buffer_.empty()) {
+			sink_.write(buffer_.data(), buffer_.size());
+			buffer_.clear();
+		}
+	}
+
+private:
+	// One partially written container during the iterative traversal
+	struct Frame
+	{
+		const Json* node;
+		size_t index;
+		JsonObject::const_iterator map_it;
+		int indent;
+		// Flat-object member order under sort_keys (indices into the
+		// flat object, sorted by key)
+		std::vector<uint32_t> order;
+	};
+
+	void write_child(const Json& child, const JsonFormat& format, int indent);
+	void append_indent(const JsonFormat& format, int depth);
+	void maybe_flush()
+	{
+		if (buffer_.size() >= flush_threshold_)
+			flush();
+	}
+
+	Sink& sink_;
+	size_t flush_threshold_;
+	std::string buffer_;
+	std::vector<Frame> stack_;
+	std::string indent_cache_;  // Grown on demand; prefix = one line's indent
+};
+
+// Sink writing into a caller's growable string
+class JsonStringSink : public JsonWriter::Sink
+{
+public:
+	explicit JsonStringSink(std::string& out) : out_(out) {}
+	void write(const char* data, size_t size) override { out_.append(data, size); }
+
+private:
+	std::string& out_;
+};
+
+// Sink writing to an open stdio stream (file, pipe, stdout)
+class JsonFileSink : public JsonWriter::Sink
+{
+public:
+	explicit JsonFileSink(std::FILE* file) : file_(file) {}
+	void write(const char* data, size_t size) override { std::fwrite(data, 1, size, file_); }
+
+private:
+	std::FILE* file_;
+};
+
+// Sink forwarding to an arbitrary callback (socket send, compressor, ...)
+class JsonCallbackSink : public JsonWriter::Sink
+{
+public:
+	explicit JsonCallbackSink(std::function<void(const char*, size_t)> callback)
+		: callback_(std::move(callback)) {}
+	void write(const char* data, size_t size) override { callback_(data, size); }
+
+private:
+	std::function<void(const char*, size_t)> callback_;
+};
+
+// Resumable push parser for network streams: feed() consumes whatever bytes
+// are available - suspending mid-string, mid-number or mid-literal and
+// resuming on the next chunk - so a document can be parsed concurrently with
+// socket reads, without staging the whole body first. Call finish() after
+// the last chunk to validate completion and take the tree. The parser owns
+// every string it produces (options.string_views is ignored: chunk buffers
+// are transient). Errors throw JsonParseError with positions counted over
+// the whole stream.
+//
+//   JsonStreamParser stream;
+//   while (read(socket, buf)) stream.feed(buf, n);
+//   Json doc = stream.finish();
+class JsonStreamParser
+{
+public:
+	explicit JsonStreamParser(const JsonParseOptions& options = {})
+		: options_(options) {}
+
+	void feed(const char* data, size_t size);
+	void feed(std::string_view chunk) { feed(chunk.data(), chunk.size()); }
+
+	// True once the root value is complete (only trailing whitespace may
+	// still arrive)
+	bool done() const { return mode_ == Mode::Done; }
+
+	// Signals end of input; validates and returns the parsed document
+	Json finish();
+
+	// Returns the parser to its initial state for the next document
+	void reset();
+
+private:
+	enum class Mode
+	{
+		ExpectValue,
+		ExpectValueOrEnd,     // Right after '['
+		ExpectKeyOrEnd,       // Right after '{'
+		ExpectKey,            // After ',' in an object
+		ExpectColon,
+		ExpectCommaOrEndArray,
+		ExpectCommaOrEndObject,
+		InString,
+		InNumber,
+		Done,
+	};
+
+	// One partially built container on the explicit stack
+	struct Frame
+	{
+		Json container;
+		std::string pending_key;
+		// Lazily built key index keeping wide flat objects O(1) per insert
+		std::unique_ptr<std::unordered_map<std::string, uint32_t>> key_index;
+	};
+
+	// Consumes as much of buffer_ as possible; returns when more input is
+	// needed. Implemented in Json.cpp.
+	void process();
+	bool dispatch_value(char c);
+	bool process_string();
+	bool process_number();
+	void finalize_number();
+	void complete_value(Json&& completed);
+	size_t absolute(size_t pos) const { return base_offset_ + pos; }
+
+	JsonParseOptions options_;
+	std::string buffer_;      // Unconsumed bytes (partial-token tail)
+	size_t pos_ = 0;          // Cursor into buffer_
+	size_t base_offset_ = 0;  // Stream position of buffer_[0]
+	Mode mode_ = Mode::ExpectValue;
+	std::vector<Frame> stack_;
+	std::string str_buf_;     // Decoded string under construction
+	bool str_is_key_ = false;
+	bool str_in_escape_ = false;
+	std::string num_buf_;     // Number token under construction
+	size_t num_start_ = 0;    // Stream position of the number's first byte
+	Json root_;
+};
+
+// A read-only memory-mapped file (mmap on POSIX, file mapping on Windows).
+// The mapped bytes are valid as long as the object lives; the OS page cache
+// is the only copy of the data. Throws std::runtime_error when the file
+// cannot be opened or mapped.
+class JsonMappedFile
+{
+public:
+	JsonMappedFile() = default;
+	explicit JsonMappedFile(const char* path);
+	~JsonMappedFile();
+
+	JsonMappedFile(JsonMappedFile&& other) noexcept;
+	JsonMappedFile& operator=(JsonMappedFile&& other) noexcept;
+	JsonMappedFile(const JsonMappedFile&) = delete;
+	JsonMappedFile& operator=(const JsonMappedFile&) = delete;
+
+	std::string_view view() const { return data_ ? std::string_view(data_, size_) : std::string_view(); }
+	bool is_open() const { return data_ != nullptr; }
+
+private:
+	void close();
+
+	const char* data_ = nullptr;
+	size_t size_ = 0;
+	// Windows file and mapping HANDLEs; unused on POSIX
+	void* file_handle_ = nullptr;
+	void* mapping_handle_ = nullptr;
+};
+
+// Bulk reader for newline-delimited JSON (NDJSON / JSON Lines): iterates the
+// records of a buffer or file reusing one scratch arena across lines, so
+// ingesting a million-line file costs no per-record parser setup and no
+// per-record container allocations. String views point into the input
+// buffer, which must outlive the reader.
+//
+// The record produced by next() lives in the scratch arena and is only valid
+// until the following next() call; copy it out (copies detach to the heap)
+// to keep it longer. Blank lines are skipped; a malformed line throws
+// JsonParseError with a position relative to that line (see line_number()).
+class JsonLinesReader
+{
+public:
+	explicit JsonLinesReader(std::string_view text, JsonParseOptions options = {});
+
+	// Memory-maps the file and iterates the mapping
+	static JsonLinesReader from_file(const char* path, JsonParseOptions options = {});
+
+	// Parses the next non-empty line into out; returns false at end of input
+	bool next(Json& out);
+
+	// 1-based input line of the record last returned by next(), or of the
+	// malformed line when next() throws
+	size_t line_number() const { return line_; }
+
+private:
+	JsonMappedFile mapping_;
+	std::string_view text_;
+	size_t pos_ = 0;
+	size_t line_ = 0;
+	JsonParseOptions options_;
+	// Held by pointer, like JsonDocument's, so moving the reader does not
+	// move the arena the current record's allocators point at
+	std::unique_ptr<JsonArena> arena_;
+};
+
+// One-pass structural index ("tape") over a raw JSON buffer: one entry per
+// value recording its type, its exact text span, and a skip link to the
+// entry after its subtree. Build it once when a buffer enters a cache, keep
+// it next to the raw bytes, and run any number of pointer lookups against
+// it - navigation hops by offsets without re-tokenizing, and only the
+// target span is ever parsed. The index stores offsets only, so it is
+// position-independent of where the buffer lives; every query takes the
+// text again and the text must be byte-identical to what was indexed.
+class JsonIndex
+{
+public:
+	enum class Kind : uint8_t { Null, False, True, Number, String, Array, Object, Key };
+
+	struct Entry
+	{
+		size_t begin;   // Byte offset of the value's first character
+		size_t end;     // One past the value's last character
+		size_t next;    // Entry index just past this value's subtree
+		Kind kind;
+	};
+
+	// Indexes the buffer in one validating pass; throws JsonParseError on
+	// malformed input
+	static JsonIndex build(std::string_view json_text, const JsonParseOptions& options = {});
+
+	// Resolves a JSON Pointer to an entry index, or npos when absent.
+	// Sibling hops use the skip links; nothing is re-tokenized.
+	static constexpr size_t npos = static_cast<size_t>(-1);
+	size_t resolve(std::string_view json_text, std::string_view pointer) const;
+
+	// Raw text span of an entry (valid JSON for value entries)
+	std::string_view span(size_t entry, std::string_view json_text) const
+	{
+		return json_text.substr(entries_[entry].begin, entries_[entry].end - entries_[entry].begin);
+	}
+
+	// Resolves the pointer and parses just the target span
+	bool extract_pointer(std::string_view json_text, std::string_view pointer,
+		Json& out, const JsonParseOptions& options = {}) const;
+
+	Kind kind(size_t entry) const { return entries_[entry].kind; }
+	size_t size() const { return entries_.size(); }
+
+private:
+	std::vector<Entry> entries_;
+};
+
+// Shared immutable document for fanning one parsed tree out to many worker
+// threads: copying a handle is one atomic refcount increment, reads through
+// root() are lock-free and never invalidated, and the tree itself is frozen.
+// Mutation goes through mutable_root(), which deep-copies the tree first
+// only when it is actually shared (copy-on-write at document granularity),
+// so other handles never observe the change. As with shared_ptr, each
+// handle belongs to one thread at a time; distinct handles need no locking.
+class JsonSharedDoc
+{
+public:
+	JsonSharedDoc() : root_(std::make_shared<Json>()) {}
+	explicit JsonSharedDoc(Json tree) : root_(std::make_shared<Json>(std::move(tree))) {}
+
+	static JsonSharedDoc parse(std::string_view json_text, const JsonParseOptions& options = {});
+
+	// Lock-free shared read access
+	const Json& root() const { return *root_; }
+
+	// Copy-on-write access: an exclusively owned tree is mutated in place,
+	// a shared one is cloned for this handle first
+	Json& mutable_root()
+	{
+		if (root_.use_count() > 1)
+			root_ = std::make_shared<Json>(*root_);
+		return *root_;
+	}
+
+	// Number of handles currently sharing the tree
+	long use_count() const { return root_.use_count(); }
+
+private:
+	std::shared_ptr<Json> root_;
+};
+
+// A parsed document that owns its own storage: the input text is copied into
+// a bump-pointer arena, the tree's containers allocate from that arena, and
+// string values are views into the arena-held copy. Dropping the document
+// frees everything in O(1) - no per-node destructor walk of the heap.
+// Nothing reachable from root() may outlive the document: copying a subtree
+// out moves its container storage to the heap, but string-view values still
+// point into the document's text buffer.
+class JsonDocument
+{
+public:
+	JsonDocument() : arena_(std::make_unique<JsonArena>()) {}
+	JsonDocument(const JsonDocument&) = delete;
+	JsonDocument& operator=(const JsonDocument&) = delete;
+	JsonDocument(JsonDocument&&) = default;
+
+	// Not defaulted: the old tree must be dropped before the arena and
+	// mapping it lives in are released, and members assign in declaration
+	// order (arena first) by default.
+	JsonDocument& operator=(JsonDocument&& other) noexcept
+	{
+		if (this != &other) {
+			root_ = Json();
+			arena_ = std::move(other.arena_);
+			mapping_ = std::move(other.mapping_);
+			text_ = other.text_;
+			root_ = std::move(other.root_);
+			other.text_ = std::string_view();
+		}
+		return *this;
+	}
+
+	// string_views is always on for documents - the views point into the
+	// arena-held copy of the text, which lives as long as the document.
+	static JsonDocument parse(std::string_view json_text, JsonParseOptions options = {});
+
+	// Memory-maps the file and parses directly over the mapped bytes: string
+	// views point into the mapping (kept alive by the document), so the page
+	// cache holds the only copy of the data.
+	static JsonDocument from_file(const char* path, JsonParseOptions options = {});
+
+	Json& root() { return root_; }
+	const Json& root() const { return root_; }
+	JsonArena& arena() { return *arena_; }
+
+	// The arena-held copy of the input text that string views point into
+	std::string_view text() const { return text_; }
+
+private:
+	// Held by pointer so moving the document does not move the arena the
+	// tree's allocators point at. arena_ and mapping_ are declared before
+	// root_ so both are destroyed after the tree.
+	std::unique_ptr<JsonArena> arena_;
+	JsonMappedFile mapping_;
+	std::string_view text_;
+	Json root_;
+};
+
+// Event interface for SAX-style streaming parsing. Derive from it and
+// override the callbacks you care about; each callback returns true to keep
+// parsing or false to stop early (useful for extracting a few fields from a
+// huge document without materializing it).
+class JsonSaxHandler
+{
+public:
+	virtual ~JsonSaxHandler() = default;
+
+	virtual bool on_null() { return true; }
+	virtual bool on_bool(bool) { return true; }
+	virtual bool on_number(double) { return true; }
+	// Integer tokens arrive here; the defaults forward to on_number so
+	// handlers that only care about the numeric value override one callback.
+	virtual bool on_int(int64_t i) { return on_number(static_cast<double>(i)); }
+	virtual bool on_uint(uint64_t u) { return on_number(static_cast<double>(u)); }
+	virtual bool on_string(const std::string&) { return true; }
+	virtual bool on_key(const std::string&) { return true; }
+	virtual bool on_begin_object() { return true; }
+	virtual bool on_end_object() { return true; }
+	virtual bool on_begin_array() { return true; }
+	virtual bool on_end_array() { return true; }
 };
 
 // Exception class for JSON parsing errors
@@ -70,10 +999,15 @@ class JsonParseError : public std::runtime_error
 public:
 	JsonParseError(const std::string& message, size_t position)
 		: std::runtime_error(message + " at position " + std::to_string(position)),
-		position_(position) {}
+		message_(message), position_(position) {}
 
 	size_t position() const { return position_; }
 
+	// The message without the appended position, for rethrowing the same
+	// error with an adjusted offset
+	const std::string& message() const { return message_; }
+
 private:
+	std::string message_;
 	size_t position_;
 };
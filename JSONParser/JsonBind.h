@@ -0,0 +1,360 @@
+#pragma once
+
+// Compile-time struct binding (serde-style): describe a struct's fields once
+// and get from_json/to_json that move data straight between JSON text and the
+// struct - no DOM is ever built on the read path (it rides the SAX parser),
+// and no tree is built on the write path.
+//
+//   struct Point { double x = 0, y = 0; };
+//   template <> struct JsonBinding<Point> {
+//       static constexpr auto fields = std::make_tuple(
+//           json_field("x", &Point::x),
+//           json_field("y", &Point::y));
+//   };
+//
+//   Point p;
+//   from_json(R"({"x": 1.5, "y": 2.5})", p);
+//   std::string text = to_json(p);
+//
+// Supported field types: bool, integral and floating-point types,
+// std::string, nested bound structs, and std::vector of any of those.
+// Unknown keys in the input are skipped without materializing anything;
+// a value whose type does not match the bound field throws
+// std::runtime_error.
+
+#include "Json.h"
+#include <tuple>
+#include <type_traits>
+
+template <typename T, typename M>
+struct JsonField
+{
+	const char* name;
+	M T::* member;
+};
+
+template <typename T, typename M>
+constexpr JsonField<T, M> json_field(const char* name, M T::* member)
+{
+	return { name, member };
+}
+
+// Specialize with a constexpr `fields` tuple of json_field entries
+template <typename T>
+struct JsonBinding;
+
+namespace json_bind_detail {
+
+template <typename T>
+struct is_vector : std::false_type {};
+template <typename E>
+struct is_vector<std::vector<E>> : std::true_type {};
+
+template <typename T, typename = void>
+struct is_bound : std::false_type {};
+template <typename T>
+struct is_bound<T, std::void_t<decltype(JsonBinding<T>::fields)>> : std::true_type {};
+
+// ----- Reading: SAX frames -----
+
+// One level of the document being bound. The handler below keeps a stack of
+// these; each frame routes scalar values and child containers into its
+// target.
+struct Frame
+{
+	virtual ~Frame() = default;
+
+	// Object frames: selects the field the next value lands in
+	virtual void select(const std::string&) {}
+	// Scalar value for the selected field (or array element)
+	virtual void scalar(Json&& v) = 0;
+	// Child containers for the selected field; nullptr means "swallow"
+	virtual Frame* begin_object() = 0;
+	virtual Frame* begin_array() = 0;
+};
+
+// Swallows everything below an unknown key
+struct IgnoreFrame : Frame
+{
+	void scalar(Json&&) override {}
+	Frame* begin_object() override { return new IgnoreFrame(); }
+	Frame* begin_array() override { return new IgnoreFrame(); }
+};
+
+template <typename M>
+void assign_scalar(M& target, Json&& v)
+{
+	if constexpr (std::is_same_v<M, bool>) {
+		target = v.as_bool();
+	}
+	else if constexpr (std::is_arithmetic_v<M>) {
+		if (!v.is_number())
+			throw std::runtime_error("JSON value is not a number");
+		target = static_cast<M>(v.as_number());
+	}
+	else if constexpr (std::is_same_v<M, std::string>) {
+		target = std::string(v.as_string_view());
+	}
+	else {
+		throw std::runtime_error("JSON scalar bound to a non-scalar field");
+	}
+}
+
+// Exact integer transfer without the double detour where it matters
+template <>
+inline void assign_scalar<int64_t>(int64_t& target, Json&& v)
+{
+	target = v.as_int();
+}
+template <>
+inline void assign_scalar<uint64_t>(uint64_t& target, Json&& v)
+{
+	target = v.as_uint();
+}
+
+template <typename T>
+struct ObjectFrame;
+
+template <typename E>
+struct ArrayFrame;
+
+// Creates the frame that binds a container value to a field of type M
+template <typename M>
+Frame* make_child_object(M& member)
+{
+	if constexpr (is_bound<M>::value)
+		return new ObjectFrame<M>(member);
+	else
+		throw std::runtime_error("JSON object bound to a non-struct field");
+}
+
+template <typename M>
+Frame* make_child_array(M& member)
+{
+	if constexpr (is_vector<M>::value) {
+		member.clear();
+		return new ArrayFrame<typename M::value_type>(member);
+	}
+	else {
+		throw std::runtime_error("JSON array bound to a non-vector field");
+	}
+}
+
+template <typename T>
+struct ObjectFrame : Frame
+{
+	explicit ObjectFrame(T& target) : target_(&target) {}
+
+	void select(const std::string& key) override
+	{
+		active_ = -1;
+		int index = 0;
+		std::apply([&](const auto&... field) {
+			((key == field.name ? (active_ = index, ++index) : ++index), ...);
+		}, JsonBinding<T>::fields);
+	}
+
+	void scalar(Json&& v) override
+	{
+		if (active_ < 0)
+			return;  // Unknown key: skip
+		dispatch([&](auto& member) { assign_scalar(member, std::move(v)); });
+	}
+
+	Frame* begin_object() override
+	{
+		if (active_ < 0)
+			return new IgnoreFrame();
+		Frame* child = nullptr;
+		dispatch([&](auto& member) { child = make_child_object(member); });
+		return child;
+	}
+
+	Frame* begin_array() override
+	{
+		if (active_ < 0)
+			return new IgnoreFrame();
+		Frame* child = nullptr;
+		dispatch([&](auto& member) { child = make_child_array(member); });
+		return child;
+	}
+
+private:
+	// Invokes fn on the member the active field refers to
+	template <typename Fn>
+	void dispatch(Fn&& fn)
+	{
+		int index = 0;
+		std::apply([&](const auto&... field) {
+			((index++ == active_ ? (fn(target_->*(field.member)), 0) : 0), ...);
+		}, JsonBinding<T>::fields);
+	}
+
+	T* target_;
+	int active_ = -1;
+};
+
+template <typename E>
+struct ArrayFrame : Frame
+{
+	explicit ArrayFrame(std::vector<E>& target) : target_(&target) {}
+
+	void scalar(Json&& v) override
+	{
+		E element{};
+		assign_scalar(element, std::move(v));
+		target_->push_back(std::move(element));
+	}
+
+	Frame* begin_object() override
+	{
+		target_->emplace_back();
+		return make_child_object(target_->back());
+	}
+
+	Frame* begin_array() override
+	{
+		target_->emplace_back();
+		return make_child_array(target_->back());
+	}
+
+private:
+	std::vector<E>* target_;
+};
+
+// Routes SAX events into the frame stack
+class BindHandler : public JsonSaxHandler
+{
+public:
+	explicit BindHandler(Frame* root) { frames_.emplace_back(root); }
+
+	bool on_key(const std::string& key) override
+	{
+		frames_.back()->select(key);
+		return true;
+	}
+
+	bool on_null() override { top(); return true; }  // Leaves the field's default
+	bool on_bool(bool b) override { top()->scalar(Json(b)); return true; }
+	bool on_int(int64_t i) override { top()->scalar(Json(i)); return true; }
+	bool on_uint(uint64_t u) override { top()->scalar(Json(u)); return true; }
+	bool on_number(double d) override { top()->scalar(Json(d)); return true; }
+	bool on_string(const std::string& s) override { top()->scalar(Json(s)); return true; }
+
+	bool on_begin_object() override
+	{
+		if (!started_) {
+			started_ = true;  // The root frame is already on the stack
+			return true;
+		}
+		frames_.emplace_back(frames_.back()->begin_object());
+		return true;
+	}
+
+	bool on_begin_array() override
+	{
+		if (!started_)
+			throw std::runtime_error("Root JSON value is not an object");
+		frames_.emplace_back(frames_.back()->begin_array());
+		return true;
+	}
+
+	bool on_end_object() override { pop(); return true; }
+	bool on_end_array() override { pop(); return true; }
+
+private:
+	Frame* top()
+	{
+		if (!started_)
+			throw std::runtime_error("Root JSON value is not an object");
+		return frames_.back().get();
+	}
+
+	void pop()
+	{
+		if (frames_.size() > 1)
+			frames_.pop_back();
+	}
+
+	std::vector<std::unique_ptr<Frame>> frames_;
+	bool started_ = false;
+};
+
+// ----- Writing: direct append, no tree -----
+
+template <typename M>
+void append_value(std::string& out, const M& member)
+{
+	if constexpr (is_bound<M>::value) {
+		out += '{';
+		bool first = true;
+		std::apply([&](const auto&... field) {
+			((out += first ? "" : ",", first = false,
+				Json(field.name).stringify_to(out),
+				out += ": ",
+				append_value(out, member.*(field.member))), ...);
+		}, JsonBinding<M>::fields);
+		out += '}';
+	}
+	else if constexpr (is_vector<M>::value) {
+		out += '[';
+		for (size_t i = 0; i < member.size(); ++i) {
+			if (i) out += ',';
+			append_value(out, member[i]);
+		}
+		out += ']';
+	}
+	else if constexpr (std::is_same_v<M, bool>) {
+		out += member ? "true" : "false";
+	}
+	else if constexpr (std::is_integral_v<M> && std::is_signed_v<M>) {
+		Json(static_cast<int64_t>(member)).stringify_to(out);
+	}
+	else if constexpr (std::is_integral_v<M>) {
+		Json(static_cast<uint64_t>(member)).stringify_to(out);
+	}
+	else if constexpr (std::is_floating_point_v<M>) {
+		Json(static_cast<double>(member)).stringify_to(out);
+	}
+	else {
+		Json(member).stringify_to(out);
+	}
+}
+
+}  // namespace json_bind_detail
+
+// Deserializes text straight into out, field by field, without building a
+// DOM. Fields absent from the input keep their current values.
+template <typename T>
+void from_json(std::string_view json_text, T& out)
+{
+	static_assert(json_bind_detail::is_bound<T>::value,
+		"from_json requires a JsonBinding<T> specialization");
+	json_bind_detail::BindHandler handler(new json_bind_detail::ObjectFrame<T>(out));
+	Json::sax_parse(json_text, handler);
+}
+
+template <typename T>
+T from_json(std::string_view json_text)
+{
+	T result{};
+	from_json(json_text, result);
+	return result;
+}
+
+// Serializes obj directly into out (appending) without building a tree
+template <typename T>
+void to_json(const T& obj, std::string& out)
+{
+	static_assert(json_bind_detail::is_bound<T>::value,
+		"to_json requires a JsonBinding<T> specialization");
+	json_bind_detail::append_value(out, obj);
+}
+
+template <typename T>
+std::string to_json(const T& obj)
+{
+	std::string out;
+	to_json(obj, out);
+	return out;
+}
@@ -298,6 +298,119 @@ void example_api_response()
 	}
 }
 
+// Example 9: Streaming (SAX) parsing - extract fields without building a DOM
+void example_sax_parsing()
+{
+	print_separator("Example 9: Streaming (SAX) Parsing");
+
+	std::string json_str = R"({
+		"status": "success",
+		"count": 3,
+		"items": [
+			{"id": 1, "name": "alpha"},
+			{"id": 2, "name": "beta"},
+			{"id": 3, "name": "gamma"}
+		]
+	})";
+
+	// A handler that counts events and grabs the "status" field, then stops
+	// as soon as it has what it needs.
+	class StatusExtractor : public JsonSaxHandler
+	{
+	public:
+		std::string status;
+		size_t strings_seen = 0;
+
+		bool on_key(const std::string& key) override
+		{
+			want_status_ = (key == "status");
+			return true;
+		}
+
+		bool on_string(const std::string& s) override
+		{
+			++strings_seen;
+			if (want_status_) {
+				status = s;
+				return false;  // Got it - stop parsing the rest
+			}
+			return true;
+		}
+
+	private:
+		bool want_status_ = false;
+	};
+
+	try {
+		StatusExtractor extractor;
+		bool completed = Json::sax_parse(json_str, extractor);
+
+		std::cout << "Extracted status: " << extractor.status << "\n";
+		std::cout << "Strings visited before stopping: " << extractor.strings_seen << "\n";
+		std::cout << "Parsed whole document: " << (completed ? "yes" : "no (stopped early)") << "\n";
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error: " << e.what() << "\n";
+	}
+}
+
+// Example 10: Zero-copy parsing with string views
+void example_zero_copy_parsing()
+{
+	print_separator("Example 10: Zero-Copy Parsing");
+
+	// The buffer must outlive the parsed tree - string values point into it.
+	std::string buffer = R"({
+		"host": "telemetry.example.com",
+		"region": "eu-west-1",
+		"note": "escaped \"quotes\" force a copy"
+	})";
+
+	try {
+		Json json = Json::parse_view(buffer);
+
+		std::cout << "host:   " << json["host"].as_string_view()
+			<< (json["host"].is_string_view() ? "  (view into buffer)" : "  (owned copy)") << "\n";
+		std::cout << "region: " << json["region"].as_string_view()
+			<< (json["region"].is_string_view() ? "  (view into buffer)" : "  (owned copy)") << "\n";
+		std::cout << "note:   " << json["note"].as_string_view()
+			<< (json["note"].is_string_view() ? "  (view into buffer)" : "  (owned copy)") << "\n";
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error: " << e.what() << "\n";
+	}
+}
+
+// Example 11: Incremental parsing of a network-style stream
+void example_stream_parsing()
+{
+	print_separator("Example 11: Incremental (Push) Parsing");
+
+	// Chunks as they might arrive from a socket - note the string and the
+	// number split across chunk boundaries
+	std::vector<std::string> chunks = {
+		R"({"event": "sen)",
+		R"(sor_update", "reading": 23.7)",
+		R"(5, "ok": tr)",
+		R"(ue})",
+	};
+
+	try {
+		JsonStreamParser stream;
+		for (const std::string& chunk : chunks) {
+			stream.feed(chunk);
+			std::cout << "fed " << chunk.size() << " bytes, document "
+				<< (stream.done() ? "complete" : "incomplete") << "\n";
+		}
+
+		Json json = stream.finish();
+		std::cout << "\nParsed: " << json.stringify() << "\n";
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Error: " << e.what() << "\n";
+	}
+}
+
 int main()
 {
 	std::cout << R"(
@@ -323,6 +436,9 @@ int main()
 		example_modifying_json();
 		example_error_handling();
 		example_api_response();
+		example_sax_parsing();
+		example_zero_copy_parsing();
+		example_stream_parsing();
 
 		std::cout << "\n" << std::string(60, '=') << "\n";
 		std::cout << "  All examples completed successfully!\n";
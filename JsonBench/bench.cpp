@@ -0,0 +1,262 @@
+/**
+ * JSON Parser - Benchmark suite
+ *
+ * Measures parse and stringify throughput (MB/s) and allocations per parse
+ * across synthetic corpora modeled on the standard benchmark workloads:
+ * - twitter-like:  string-heavy (messages, names, escapes, unicode)
+ * - canada-like:   number-heavy (long arrays of coordinate doubles)
+ * - citm-like:     structure-heavy (deeply nested objects, many small ints)
+ * - nested:        pathological depth (guards against superlinear parsing)
+ *
+ * Each case runs the plain DOM parser and the arena-backed document parser
+ * (string views + flat objects). Results print as a table; pass
+ * "--csv <path>" to also emit machine-readable rows for regression
+ * tracking release-over-release.
+ */
+
+#include "Json.h"
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// ========== Allocation Counting ==========
+
+static size_t g_alloc_count = 0;
+
+void* operator new(size_t size)
+{
+	++g_alloc_count;
+	return std::malloc(size);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+// ========== Corpus Generators ==========
+
+// Deterministic pseudo-random source so runs are comparable
+static uint64_t g_rng_state = 0x9e3779b97f4a7c15ull;
+
+static uint64_t next_random()
+{
+	g_rng_state ^= g_rng_state << 13;
+	g_rng_state ^= g_rng_state >> 7;
+	g_rng_state ^= g_rng_state << 17;
+	return g_rng_state;
+}
+
+static std::string make_twitter_like(size_t records)
+{
+	static const char* fragments[] = {
+		"just shipped a new release",
+		"benchmarking JSON parsers all day \\u00e9\\u00e8",
+		"quoted \\\"text\\\" with a tab\\there",
+		"plain ascii message body with several words in it",
+	};
+
+	std::string out = "{\"statuses\": [";
+	for (size_t i = 0; i < records; ++i) {
+		if (i) out += ',';
+		out += "{\"id\": " + std::to_string(100000000000ull + i * 7919);
+		out += ", \"text\": \"";
+		out += fragments[next_random() % 4];
+		out += " #";
+		out += std::to_string(next_random() % 10000);
+		out += "\", \"user\": {\"id\": " + std::to_string(next_random() % 10000000);
+		out += ", \"screen_name\": \"user_" + std::to_string(next_random() % 100000);
+		out += "\", \"followers_count\": " + std::to_string(next_random() % 50000);
+		out += ", \"verified\": ";
+		out += (next_random() % 2) ? "true" : "false";
+		out += "}, \"retweet_count\": " + std::to_string(next_random() % 1000);
+		out += ", \"lang\": \"en\"}";
+	}
+	out += "]}";
+	return out;
+}
+
+static std::string make_canada_like(size_t rings)
+{
+	std::string out = "{\"type\": \"FeatureCollection\", \"features\": [{\"type\": \"Feature\","
+		"\"geometry\": {\"type\": \"Polygon\", \"coordinates\": [";
+	for (size_t r = 0; r < rings; ++r) {
+		if (r) out += ',';
+		out += '[';
+		for (size_t p = 0; p < 100; ++p) {
+			if (p) out += ',';
+			char buf[64];
+			std::snprintf(buf, sizeof(buf), "[-%zu.%06llu,%zu.%06llu]",
+				60 + r % 40, static_cast<unsigned long long>(next_random() % 1000000),
+				40 + p % 40, static_cast<unsigned long long>(next_random() % 1000000));
+			out += buf;
+		}
+		out += ']';
+	}
+	out += "]}}]}";
+	return out;
+}
+
+static std::string make_citm_like(size_t events)
+{
+	std::string out = "{\"events\": {";
+	for (size_t i = 0; i < events; ++i) {
+		if (i) out += ',';
+		out += "\"" + std::to_string(100000 + i) + "\": {\"id\": " + std::to_string(100000 + i);
+		out += ", \"name\": \"Event " + std::to_string(i);
+		out += "\", \"subTopicIds\": [";
+		for (int s = 0; s < 6; ++s) {
+			if (s) out += ',';
+			out += std::to_string(337180000 + static_cast<int>(next_random() % 100));
+		}
+		out += "], \"prices\": [{\"amount\": " + std::to_string(1000 + next_random() % 9000);
+		out += ", \"audienceSubCategoryId\": " + std::to_string(337000000 + next_random() % 1000);
+		out += ", \"seatCategoryId\": " + std::to_string(338700000 + next_random() % 100);
+		out += "}], \"logo\": null}";
+	}
+	out += "}}";
+	return out;
+}
+
+static std::string make_nested(size_t depth)
+{
+	std::string out;
+	for (size_t i = 0; i < depth; ++i)
+		out += "{\"child\": [1, 2, ";
+	out += "null";
+	for (size_t i = 0; i < depth; ++i)
+		out += "]}";
+	return out;
+}
+
+// ========== Measurement ==========
+
+struct BenchResult
+{
+	std::string corpus;
+	std::string engine;
+	size_t bytes = 0;
+	double parse_mbps = 0.0;
+	double stringify_mbps = 0.0;
+	size_t allocs_per_parse = 0;
+};
+
+template <typename Fn>
+static double best_seconds(Fn&& fn, int repetitions)
+{
+	double best = 1e30;
+	for (int i = 0; i < repetitions; ++i) {
+		auto start = std::chrono::steady_clock::now();
+		fn();
+		auto stop = std::chrono::steady_clock::now();
+		double seconds = std::chrono::duration<double>(stop - start).count();
+		if (seconds < best)
+			best = seconds;
+	}
+	return best;
+}
+
+static BenchResult run_case(const std::string& corpus, const std::string& text,
+	bool arena_engine, int repetitions, JsonParseOptions options = {})
+{
+	BenchResult result;
+	result.corpus = corpus;
+	result.engine = arena_engine ? "document" : "dom";
+	result.bytes = text.size();
+
+	double mb = static_cast<double>(text.size()) / (1024.0 * 1024.0);
+
+	size_t allocs_before = g_alloc_count;
+	Json tree;
+	JsonDocument document;
+	JsonParseOptions document_options = options;
+	document_options.flat_objects = true;
+	if (arena_engine)
+		document = JsonDocument::parse(text, document_options);
+	else
+		tree = Json::parse(text, options);
+	result.allocs_per_parse = g_alloc_count - allocs_before;
+
+	result.parse_mbps = mb / best_seconds([&]() {
+		if (arena_engine)
+			document = JsonDocument::parse(text, document_options);
+		else
+			tree = Json::parse(text, options);
+	}, repetitions);
+
+	const Json& root = arena_engine ? document.root() : tree;
+	std::string out;
+	result.stringify_mbps = mb / best_seconds([&]() {
+		out.clear();
+		root.stringify_to(out);
+	}, repetitions);
+
+	return result;
+}
+
+// ========== Reporting ==========
+
+static void print_table(const std::vector<BenchResult>& results)
+{
+	std::cout << std::left << std::setw(14) << "corpus"
+		<< std::setw(10) << "engine"
+		<< std::right << std::setw(12) << "size (KB)"
+		<< std::setw(14) << "parse MB/s"
+		<< std::setw(16) << "stringify MB/s"
+		<< std::setw(14) << "allocs" << "\n";
+	std::cout << std::string(80, '-') << "\n";
+
+	for (const auto& r : results) {
+		std::cout << std::left << std::setw(14) << r.corpus
+			<< std::setw(10) << r.engine
+			<< std::right << std::setw(12) << r.bytes / 1024
+			<< std::setw(14) << std::fixed << std::setprecision(1) << r.parse_mbps
+			<< std::setw(16) << r.stringify_mbps
+			<< std::setw(14) << r.allocs_per_parse << "\n";
+	}
+}
+
+static void write_csv(const std::vector<BenchResult>& results, const char* path)
+{
+	std::ofstream csv(path);
+	csv << "corpus,engine,bytes,parse_mbps,stringify_mbps,allocs_per_parse\n";
+	for (const auto& r : results) {
+		csv << r.corpus << ',' << r.engine << ',' << r.bytes << ','
+			<< r.parse_mbps << ',' << r.stringify_mbps << ',' << r.allocs_per_parse << "\n";
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const char* csv_path = nullptr;
+	int repetitions = 5;
+	for (int i = 1; i < argc; ++i) {
+		if (std::string(argv[i]) == "--csv" && i + 1 < argc)
+			csv_path = argv[++i];
+		else if (std::string(argv[i]) == "--quick")
+			repetitions = 2;
+	}
+
+	struct Corpus { const char* name; std::string text; JsonParseOptions options; };
+	std::vector<Corpus> corpora;
+	corpora.push_back({ "twitter-like", make_twitter_like(20000), {} });
+	corpora.push_back({ "canada-like", make_canada_like(500), {} });
+	corpora.push_back({ "citm-like", make_citm_like(10000), {} });
+	// Deeper than the default nesting limit on purpose
+	corpora.push_back({ "nested", make_nested(1500), JsonParseOptions{ .max_depth = 4000 } });
+
+	std::vector<BenchResult> results;
+	for (const auto& corpus : corpora) {
+		results.push_back(run_case(corpus.name, corpus.text, false, repetitions, corpus.options));
+		results.push_back(run_case(corpus.name, corpus.text, true, repetitions, corpus.options));
+	}
+
+	print_table(results);
+	if (csv_path) {
+		write_csv(results, csv_path);
+		std::cout << "\nCSV written to " << csv_path << "\n";
+	}
+	return 0;
+}